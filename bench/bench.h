@@ -0,0 +1,79 @@
+/*
+ * Timing and random number helpers for benchmarks.
+ *
+ * Dedicated to the public domain. Use it as you wish.
+ */
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * Monotonic wall clock time in seconds.
+ */
+static inline double Bench_Seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+/**
+ * xorshift64* pseudo-random number generator. @p state must be non-zero.
+ */
+static inline uint64_t Bench_Random(uint64_t* state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ull;
+}
+
+/**
+ * Prints one result row.
+ */
+static inline void Bench_Report(const char* name, double seconds, size_t ops)
+{
+    printf("%-40s %10.2f ns/op\n", name, seconds * 1e9 / (double) ops);
+}
+
+/**
+ * Prints the column headings for Bench_ReportRow.
+ */
+static inline void Bench_ReportHeader(void)
+{
+    printf("%-44s %10s %10s %10s\n", "ns/op", "seq", "rand", "miss");
+}
+
+/**
+ * Prints one result row of sequential, random and missing key timings, in
+ * nanoseconds. Negative timings print as "-".
+ */
+static inline void Bench_ReportRow(const char* name, double seq, double rand, double miss)
+{
+    double columns[3];
+    size_t idx;
+
+    columns[0] = seq;
+    columns[1] = rand;
+    columns[2] = miss;
+
+    printf("%-44s", name);
+    for (idx = 0; idx < 3; ++idx)
+    {
+        if (columns[idx] < 0)
+        {
+            printf(" %10s", "-");
+        }
+        else
+        {
+            printf(" %10.2f", columns[idx]);
+        }
+    }
+    printf("\n");
+}
+
+#endif /* BENCH_H */
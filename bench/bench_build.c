@@ -0,0 +1,31 @@
+/*
+ * One translation unit of the build benchmark: the enum BENCH_BUILD from
+ * BENCH_ENUM_H, its table and a ToString named BENCH_TOSTRING.
+ *
+ * Define BENCH_POOL for ENUM_IMPL_POOL in place of ENUM_IMPL, BENCH_PREFIX
+ * for ENUM_IMPL_PREFIX, with BENCH_ENUM_H generated "prefixed", or
+ * BENCH_EXTERN for ENUM_DECLARE_IMPL, with BENCH_DEFINE in the one
+ * translation unit which expands ENUM_DEFINE_IMPL.
+ *
+ * Dedicated to the public domain. Use it as you wish.
+ */
+#include "enum.h"
+#include "enum_pool.h"
+#include "enum_prefix.h"
+
+#include BENCH_ENUM_H
+
+ENUM(BENCH_BUILD);
+#if defined(BENCH_POOL)
+ENUM_IMPL_POOL(BENCH_BUILD, uint32_t);
+#elif defined(BENCH_PREFIX)
+ENUM_IMPL_PREFIX(BENCH_BUILD, BENCH_BUILD_, BENCH_BUILD_SUFFIXES);
+#elif defined(BENCH_EXTERN)
+ENUM_DECLARE_IMPL(BENCH_BUILD);
+#if defined(BENCH_DEFINE)
+ENUM_DEFINE_IMPL(BENCH_BUILD);
+#endif
+#else
+ENUM_IMPL(BENCH_BUILD);
+#endif
+ENUM_DEFINE_TOSTRING(BENCH_BUILD, BENCH_TOSTRING)
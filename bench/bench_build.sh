@@ -0,0 +1,82 @@
+#!/bin/sh
+#
+# Measures how the cost of building an enum grows with its element count.
+#
+# Usage: bench_build.sh [COUNT...]
+#
+# For each count (default 1024 4096 16384 65536) and table layout, a sparse
+# enum is generated and bench_build.c is compiled as two translation units,
+# which are linked into one shared object, as a library would be. The impl,
+# pool and prefix layouts give each unit its own table; the extern layout
+# defines one table, in the first unit. The prefix layout generates the enum
+# from a list of suffixes. Reported:
+#
+#   cpp ms        time to preprocess one translation unit
+#   cpp KB        size of its preprocessed output
+#   cc ms         time to compile it, with CFLAGS
+#   .rodata       bytes of read-only data in the shared object
+#   .data.rel.ro  bytes of data which is read-only after relocation
+#   relocs        dynamic relocations, each a write at load time
+#
+# Environment: CC (default cc) and CFLAGS (default -O2).
+#
+# Dedicated to the public domain. Use it as you wish.
+
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--O2}
+DIR=$(dirname "$0")
+OUT=$DIR/gen/build
+
+if [ $# -eq 0 ]; then
+    set -- 1024 4096 16384 65536
+fi
+
+mkdir -p "$OUT" || exit 1
+
+now_ms() {
+    echo $(($(date +%s%N) / 1000000))
+}
+
+section() {
+    size -A "$1" | awk -v name="$2" '$1 == name { bytes = $2 } END { print bytes + 0 }'
+}
+
+printf "%-6s %8s %8s %8s %8s %10s %13s %8s\n" \
+    layout elements "cpp ms" "cpp KB" "cc ms" .rodata .data.rel.ro relocs
+
+for count in "$@"; do
+    sh "$DIR/gen_enum.sh" BENCH_BUILD "$count" sparse > "$OUT/build_$count.h" || exit 1
+    sh "$DIR/gen_enum.sh" BENCH_BUILD "$count" sparse prefixed > "$OUT/build_${count}_prefixed.h" || exit 1
+
+    for layout in impl pool prefix extern; do
+        flags="$CFLAGS -std=c99 -fPIC -I$DIR/.. -DBENCH_ENUM_H=\"gen/build/build_$count.h\""
+        define=
+        if [ "$layout" = pool ]; then
+            flags="$flags -DBENCH_POOL"
+        elif [ "$layout" = prefix ]; then
+            flags="$CFLAGS -std=c99 -fPIC -I$DIR/.. -DBENCH_ENUM_H=\"gen/build/build_${count}_prefixed.h\" -DBENCH_PREFIX"
+        elif [ "$layout" = extern ]; then
+            flags="$flags -DBENCH_EXTERN"
+            define=-DBENCH_DEFINE
+        fi
+
+        start=$(now_ms)
+        $CC $flags $define -DBENCH_TOSTRING=Bench_ToString1 -E -o "$OUT/$layout.i" "$DIR/bench_build.c" || exit 1
+        cpp_ms=$(($(now_ms) - start))
+        cpp_kb=$(($(wc -c < "$OUT/$layout.i") / 1024))
+
+        start=$(now_ms)
+        $CC $flags $define -DBENCH_TOSTRING=Bench_ToString1 -c -o "$OUT/${layout}1.o" "$DIR/bench_build.c" || exit 1
+        cc_ms=$(($(now_ms) - start))
+
+        $CC $flags -DBENCH_TOSTRING=Bench_ToString2 -c -o "$OUT/${layout}2.o" "$DIR/bench_build.c" || exit 1
+        $CC -shared -o "$OUT/$layout.so" "$OUT/${layout}1.o" "$OUT/${layout}2.o" || exit 1
+
+        rodata=$(section "$OUT/$layout.so" .rodata)
+        relro=$(section "$OUT/$layout.so" .data.rel.ro)
+        relocs=$(readelf -r -W "$OUT/$layout.so" | grep -c '^[0-9a-f]\{8,\} ')
+
+        printf "%-6s %8d %8d %8d %8d %10d %13d %8d\n" \
+            "$layout" "$count" "$cpp_ms" "$cpp_kb" "$cc_ms" "$rodata" "$relro" "$relocs"
+    done
+done
@@ -0,0 +1,143 @@
+/*
+ * Compares ENUM_DEFINE_COUNTER with a single shared array of atomic
+ * counters, with BENCH_THREADS threads each counting random elements of a
+ * 64 element sparse enum.
+ *
+ * Both index their array through the same IndexOf function, so the
+ * difference is the sharing: every thread's increments of the shared array
+ * contend for the same few cache lines, while each thread owns a shard of
+ * the counter.
+ *
+ * Dedicated to the public domain. Use it as you wish.
+ */
+#include "bench.h"
+
+#include "enum.h"
+#include "enum_counter.h"
+#include "enum_indexof.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "gen/sparse_64.h"
+
+#ifndef BENCH_THREADS
+#define BENCH_THREADS 64
+#endif
+
+#define KEYS 4096u
+#define OPS (1u << 20)
+
+ENUM(BENCH_SPARSE);
+ENUM_IMPL(BENCH_SPARSE);
+ENUM_DEFINE_INDEXOF(BENCH_SPARSE, Bench_IndexOf)
+ENUM_DEFINE_ITERATOR(BENCH_SPARSE, Bench_IteratorBegin, Bench_IteratorEnd, Bench_IteratorToValue)
+
+ENUM_DECLARE_COUNTER(BENCH_SPARSE, Bench_Counter, BENCH_THREADS);
+ENUM_DEFINE_COUNTER(BENCH_SPARSE, Bench_Counter, Bench_IndexOf, Bench_IteratorBegin, Bench_IteratorEnd)
+
+static enum BENCH_SPARSE keys[BENCH_THREADS][KEYS];
+
+static uint64_t shared[ENUM_COUNT(BENCH_SPARSE)];
+static Bench_Counter_t counter;
+
+/**
+ * Thread which counts its keys in the shared array of atomics.
+ */
+static void* Bench_SharedThread(void* arg)
+{
+    size_t thread = (size_t) arg;
+    size_t idx;
+
+    for (idx = 0; idx < OPS; ++idx)
+    {
+        BENCH_SPARSE_Iterator_t iter = Bench_IndexOf(keys[thread][idx % KEYS]);
+
+        __atomic_fetch_add(&shared[iter], 1, __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+/**
+ * Thread which counts its keys in its own shard of the counter.
+ */
+static void* Bench_ShardedThread(void* arg)
+{
+    size_t thread = (size_t) arg;
+    size_t idx;
+
+    for (idx = 0; idx < OPS; ++idx)
+    {
+        Bench_Counter_Increment(&counter, thread, keys[thread][idx % KEYS]);
+    }
+
+    return NULL;
+}
+
+/**
+ * Times BENCH_THREADS threads of @p thread_f, and reports nanoseconds per
+ * increment over all threads.
+ */
+static void Bench_Run(const char* name, void* (*thread_f)(void*))
+{
+    pthread_t threads[BENCH_THREADS];
+    double start = Bench_Seconds();
+    size_t thread;
+
+    for (thread = 0; thread < BENCH_THREADS; ++thread)
+    {
+        if (pthread_create(&threads[thread], NULL, thread_f, (void*) thread) != 0)
+        {
+            perror("pthread_create");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    for (thread = 0; thread < BENCH_THREADS; ++thread)
+    {
+        pthread_join(threads[thread], NULL);
+    }
+
+    Bench_Report(name, Bench_Seconds() - start, (size_t) BENCH_THREADS * OPS);
+}
+
+int main(void)
+{
+    uint64_t state = 88172645463325252ull;
+    uint64_t totals[ENUM_COUNT(BENCH_SPARSE)];
+    uint64_t shared_sum = 0;
+    uint64_t sharded_sum = 0;
+    size_t thread;
+    size_t idx;
+
+    for (thread = 0; thread < BENCH_THREADS; ++thread)
+    {
+        for (idx = 0; idx < KEYS; ++idx)
+        {
+            keys[thread][idx] = Bench_IteratorToValue(Bench_Random(&state) % ENUM_COUNT(BENCH_SPARSE));
+        }
+    }
+
+    printf("%d threads, %d element sparse enum, %u increments per thread\n",
+           BENCH_THREADS, ENUM_COUNT(BENCH_SPARSE), OPS);
+
+    Bench_Run("shared atomic array", Bench_SharedThread);
+    Bench_Run("ENUM_DEFINE_COUNTER", Bench_ShardedThread);
+
+    Bench_Counter_Aggregate(&counter, totals);
+    for (idx = 0; idx < ENUM_COUNT(BENCH_SPARSE); ++idx)
+    {
+        shared_sum += shared[idx];
+        sharded_sum += totals[idx];
+    }
+
+    if (shared_sum != (uint64_t) BENCH_THREADS * OPS || sharded_sum != shared_sum)
+    {
+        printf("count mismatch: shared %llu, sharded %llu\n",
+               (unsigned long long) shared_sum, (unsigned long long) sharded_sum);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
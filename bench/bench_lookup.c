@@ -0,0 +1,388 @@
+/*
+ * Times the lookups of one generated enum, BENCH_ENUM from BENCH_ENUM_H.
+ *
+ * Each lookup is timed over three key arrays:
+ *
+ *   seq   Every element in declaration order, repeated. Table reads are
+ *         sequential and branches predictable.
+ *   rand  Elements drawn uniformly at random. For large enums each lookup
+ *         touches cold table lines, so this is the cache-miss-sensitive
+ *         figure.
+ *   miss  Random values which are not elements.
+ *
+ * Lookups which need a shape the enum lacks (contiguous, monotonic, unique
+ * values) are skipped. So is the switch above 4,096 elements, which GCC
+ * takes minutes to compile.
+ *
+ * Dedicated to the public domain. Use it as you wish.
+ */
+#include "bench.h"
+
+#include "enum.h"
+#include "enum_batch.h"
+#include "enum_contiguous.h"
+#include "enum_flags.h"
+#include "enum_indexof.h"
+#include "enum_isvalid.h"
+#include "enum_lookup.h"
+#include "enum_monotonic.h"
+#include "enum_trie.h"
+
+#include <stdlib.h>
+
+#include BENCH_ENUM_H
+
+#define KEYS (1u << 16)
+#define CHUNK 256u
+#define MIN_SECONDS 0.05
+
+ENUM(BENCH_ENUM);
+ENUM_IMPL(BENCH_ENUM);
+ENUM_DEFINE_TOSTRING(BENCH_ENUM, Bench_ToString)
+ENUM_DEFINE_FROMSTRING(BENCH_ENUM, Bench_FromString)
+ENUM_DEFINE_INDEXOF(BENCH_ENUM, Bench_IndexOf)
+ENUM_TRAITS(BENCH_ENUM);
+ENUM_DEFINE_LOOKUP(BENCH_ENUM, Bench_Lookup)
+ENUM_IMPL(ENUM_LOOKUP_MODE);
+ENUM_DEFINE_ITERATOR(BENCH_ENUM, Bench_IteratorBegin, Bench_IteratorEnd, Bench_IteratorToValue)
+ENUM_DEFINE_TOSTRING_BATCH(BENCH_ENUM, Bench_ToStringBatch, Bench_IndexOf)
+ENUM_DEFINE_TOSTRING_VIEW(BENCH_ENUM, Bench_ToStringView, Bench_IndexOf)
+ENUM_DEFINE_ISVALID(BENCH_ENUM, Bench_IsValid, Bench_IndexOf)
+ENUM_DEFINE_FROMSTRING_TRIE(BENCH_ENUM, Bench_FromTrie, Bench_IndexOf,
+                            ENUM_TRIE_FOLD_CASE | ENUM_TRIE_STRIP_PREFIX)
+ENUM_DEFINE_FLAGS_BITNAME(BENCH_ENUM, Bench_BitName)
+ENUM_DEFINE_FLAGS_TOSTRING(BENCH_ENUM, Bench_FlagsToString, Bench_BitName)
+
+#if BENCH_ENUM_UNIQUE && BENCH_ENUM_COUNT <= 4096
+ENUM_DEFINE_TOSTRING_SWITCH(BENCH_ENUM, Bench_SwitchToString)
+#endif
+#if BENCH_ENUM_CONTIGUOUS
+ENUM_DEFINE_TOSTRING_CONTIGUOUS(BENCH_ENUM, Bench_ContiguousToString)
+#endif
+#if BENCH_ENUM_MONOTONIC
+ENUM_DEFINE_TOSTRING_MONOTONIC(BENCH_ENUM, Bench_MonotonicToString)
+ENUM_DEFINE_INDEXOF_MONOTONIC(BENCH_ENUM, Bench_MonotonicIndexOf)
+#endif
+
+typedef char const* (*ToString_f)(enum BENCH_ENUM literal);
+typedef BENCH_ENUM_Iterator_t (*IndexOf_f)(enum BENCH_ENUM literal);
+/* a function type, as ENUM_STATUS( would expand the X-Macro */
+typedef enum ENUM_STATUS FromString_t(char const* str, size_t len, enum BENCH_ENUM* literal);
+
+enum KEY_SET
+{
+    KEY_SEQ,
+    KEY_RAND,
+    KEY_MISS,
+    KEY_SETS
+};
+
+static enum BENCH_ENUM keys[KEY_SETS][KEYS];
+static char const* names[KEY_SETS][KEYS];
+static size_t lengths[KEY_SETS][KEYS];
+static uint64_t masks[KEY_SETS][KEYS];
+static char const* batch_out[KEYS];
+
+/* results are accumulated here so no lookup is optimised away */
+static volatile size_t sink;
+
+/**
+ * Times @p f over the keys of @p set, in chunks until MIN_SECONDS pass.
+ */
+static double Bench_ToStringNs(ToString_f f, enum KEY_SET set)
+{
+    double start = Bench_Seconds();
+    double elapsed = 0;
+    size_t ops = 0;
+    size_t sum = 0;
+
+    do
+    {
+        size_t end = ops % KEYS + CHUNK;
+        size_t idx;
+
+        for (idx = end - CHUNK; idx < end; ++idx)
+        {
+            sum += (unsigned char) f(keys[set][idx])[0];
+        }
+
+        ops += CHUNK;
+        elapsed = Bench_Seconds() - start;
+    } while (elapsed < MIN_SECONDS);
+
+    sink += sum;
+    return elapsed * 1e9 / (double) ops;
+}
+
+/**
+ * Times @p f over the keys of @p set, as Bench_ToStringNs.
+ */
+static double Bench_IndexOfNs(IndexOf_f f, enum KEY_SET set)
+{
+    double start = Bench_Seconds();
+    double elapsed = 0;
+    size_t ops = 0;
+    size_t sum = 0;
+
+    do
+    {
+        size_t end = ops % KEYS + CHUNK;
+        size_t idx;
+
+        for (idx = end - CHUNK; idx < end; ++idx)
+        {
+            sum += (size_t) f(keys[set][idx]);
+        }
+
+        ops += CHUNK;
+        elapsed = Bench_Seconds() - start;
+    } while (elapsed < MIN_SECONDS);
+
+    sink += sum;
+    return elapsed * 1e9 / (double) ops;
+}
+
+/**
+ * Times Bench_IsValid over the keys of @p set.
+ */
+static double Bench_IsValidNs(enum KEY_SET set)
+{
+    double start = Bench_Seconds();
+    double elapsed = 0;
+    size_t ops = 0;
+    size_t sum = 0;
+
+    do
+    {
+        size_t end = ops % KEYS + CHUNK;
+        size_t idx;
+
+        for (idx = end - CHUNK; idx < end; ++idx)
+        {
+            sum += (size_t) Bench_IsValid(keys[set][idx]);
+        }
+
+        ops += CHUNK;
+        elapsed = Bench_Seconds() - start;
+    } while (elapsed < MIN_SECONDS);
+
+    sink += sum;
+    return elapsed * 1e9 / (double) ops;
+}
+
+/**
+ * Times finding names and their lengths with Bench_ToStringView over the
+ * keys of @p set.
+ */
+static double Bench_ViewNs(enum KEY_SET set)
+{
+    double start = Bench_Seconds();
+    double elapsed = 0;
+    size_t ops = 0;
+    size_t sum = 0;
+
+    do
+    {
+        size_t end = ops % KEYS + CHUNK;
+        size_t idx;
+
+        for (idx = end - CHUNK; idx < end; ++idx)
+        {
+            struct Enum_StringView name = Bench_ToStringView(keys[set][idx]);
+
+            sum += name.len + (unsigned char) name.ptr[0];
+        }
+
+        ops += CHUNK;
+        elapsed = Bench_Seconds() - start;
+    } while (elapsed < MIN_SECONDS);
+
+    sink += sum;
+    return elapsed * 1e9 / (double) ops;
+}
+
+/**
+ * Times @p f over the names of @p set.
+ */
+static double Bench_FromStringNs(FromString_t* f, enum KEY_SET set)
+{
+    double start = Bench_Seconds();
+    double elapsed = 0;
+    size_t ops = 0;
+    size_t sum = 0;
+
+    do
+    {
+        size_t end = ops % KEYS + CHUNK;
+        size_t idx;
+
+        for (idx = end - CHUNK; idx < end; ++idx)
+        {
+            enum BENCH_ENUM literal = (enum BENCH_ENUM) 0;
+
+            sum += (size_t) f(names[set][idx], lengths[set][idx], &literal);
+            sum += (size_t) literal;
+        }
+
+        ops += CHUNK;
+        elapsed = Bench_Seconds() - start;
+    } while (elapsed < MIN_SECONDS);
+
+    sink += sum;
+    return elapsed * 1e9 / (double) ops;
+}
+
+/**
+ * Times Bench_ToStringBatch over all keys of @p set per call, per element.
+ */
+static double Bench_BatchNs(enum KEY_SET set)
+{
+    double start = Bench_Seconds();
+    double elapsed = 0;
+    size_t ops = 0;
+
+    do
+    {
+        sink += Bench_ToStringBatch(keys[set], KEYS, batch_out);
+        ops += KEYS;
+        elapsed = Bench_Seconds() - start;
+    } while (elapsed < MIN_SECONDS);
+
+    return elapsed * 1e9 / (double) ops;
+}
+
+/**
+ * Times Bench_FlagsToString over the masks of @p set.
+ */
+static double Bench_FlagsNs(enum KEY_SET set)
+{
+    char buf[256];
+    double start = Bench_Seconds();
+    double elapsed = 0;
+    size_t ops = 0;
+    size_t sum = 0;
+
+    do
+    {
+        size_t end = ops % KEYS + CHUNK;
+        size_t idx;
+
+        for (idx = end - CHUNK; idx < end; ++idx)
+        {
+            sum += Bench_FlagsToString(masks[set][idx], buf, sizeof(buf));
+        }
+
+        ops += CHUNK;
+        elapsed = Bench_Seconds() - start;
+    } while (elapsed < MIN_SECONDS);
+
+    sink += sum;
+    return elapsed * 1e9 / (double) ops;
+}
+
+/**
+ * Times a walk over every element with the iterator functions, per element.
+ */
+static double Bench_IteratorNs(void)
+{
+    double start = Bench_Seconds();
+    double elapsed = 0;
+    size_t ops = 0;
+    size_t sum = 0;
+
+    do
+    {
+        BENCH_ENUM_Iterator_t iter;
+
+        for (iter = Bench_IteratorBegin(); iter <= Bench_IteratorEnd(); iter++)
+        {
+            sum += (size_t) Bench_IteratorToValue(iter);
+        }
+
+        ops += sizeof(BENCH_ENUM_IMPL) / sizeof(*BENCH_ENUM_IMPL);
+        elapsed = Bench_Seconds() - start;
+    } while (elapsed < MIN_SECONDS);
+
+    sink += sum;
+    return elapsed * 1e9 / (double) ops;
+}
+
+#define BENCH_TOSTRING(name, f) \
+    Bench_ReportRow(name, Bench_ToStringNs(f, KEY_SEQ), \
+                    Bench_ToStringNs(f, KEY_RAND), Bench_ToStringNs(f, KEY_MISS))
+
+#define BENCH_INDEXOF(name, f) \
+    Bench_ReportRow(name, Bench_IndexOfNs(f, KEY_SEQ), \
+                    Bench_IndexOfNs(f, KEY_RAND), Bench_IndexOfNs(f, KEY_MISS))
+
+#define BENCH_FROMSTRING(name, f) \
+    Bench_ReportRow(name, Bench_FromStringNs(f, KEY_SEQ), \
+                    Bench_FromStringNs(f, KEY_RAND), Bench_FromStringNs(f, KEY_MISS))
+
+int main(void)
+{
+    uint64_t state = 88172645463325252ull;
+    size_t count = sizeof(BENCH_ENUM_IMPL) / sizeof(*BENCH_ENUM_IMPL);
+    char lookup_name[64];
+    size_t idx;
+
+    for (idx = 0; idx < KEYS; ++idx)
+    {
+        size_t member = (size_t) (Bench_Random(&state) % count);
+
+        keys[KEY_SEQ][idx] = BENCH_ENUM_ValueAt(idx % count);
+        keys[KEY_RAND][idx] = BENCH_ENUM_ValueAt(member);
+        /* generated values are never negative */
+        keys[KEY_MISS][idx] = (enum BENCH_ENUM) (-1 - (int) (Bench_Random(&state) % 1000));
+
+        names[KEY_SEQ][idx] = BENCH_ENUM_NameAt(idx % count);
+        names[KEY_RAND][idx] = BENCH_ENUM_NameAt(member);
+        names[KEY_MISS][idx] = "BENCH_ENUM_MISSING";
+
+        masks[KEY_SEQ][idx] = (uint64_t) keys[KEY_SEQ][idx] | (uint64_t) BENCH_ENUM_ValueAt((idx + 1) % count);
+        masks[KEY_RAND][idx] = (uint64_t) keys[KEY_RAND][idx] | (uint64_t) BENCH_ENUM_ValueAt(Bench_Random(&state) % count);
+        masks[KEY_MISS][idx] = (uint64_t) 1 << (32 + Bench_Random(&state) % 32);
+    }
+
+    for (idx = 0; idx < KEYS; ++idx)
+    {
+        lengths[KEY_SEQ][idx] = strlen(names[KEY_SEQ][idx]);
+        lengths[KEY_RAND][idx] = strlen(names[KEY_RAND][idx]);
+        lengths[KEY_MISS][idx] = strlen(names[KEY_MISS][idx]);
+    }
+
+    printf("\n%s, %zu elements\n", BENCH_ENUM_LAYOUT, count);
+    Bench_ReportHeader();
+
+    BENCH_TOSTRING("ENUM_DEFINE_TOSTRING", Bench_ToString);
+#if BENCH_ENUM_UNIQUE && BENCH_ENUM_COUNT <= 4096
+    BENCH_TOSTRING("ENUM_DEFINE_TOSTRING_SWITCH", Bench_SwitchToString);
+#endif
+#if BENCH_ENUM_CONTIGUOUS
+    BENCH_TOSTRING("ENUM_DEFINE_TOSTRING_CONTIGUOUS", Bench_ContiguousToString);
+#endif
+#if BENCH_ENUM_MONOTONIC
+    BENCH_TOSTRING("ENUM_DEFINE_TOSTRING_MONOTONIC", Bench_MonotonicToString);
+    BENCH_INDEXOF("ENUM_DEFINE_INDEXOF_MONOTONIC", Bench_MonotonicIndexOf);
+#endif
+    BENCH_INDEXOF("ENUM_DEFINE_INDEXOF", Bench_IndexOf);
+    snprintf(lookup_name, sizeof(lookup_name), "ENUM_DEFINE_LOOKUP (%s)",
+             ENUM_LOOKUP_MODE_NameAt(ENUM_LOOKUP_MODE_OF(BENCH_ENUM)));
+    BENCH_INDEXOF(lookup_name, Bench_Lookup);
+    Bench_ReportRow(Bench_IsValid_BITMAP ? "ENUM_DEFINE_ISVALID (bitmap)" : "ENUM_DEFINE_ISVALID (IndexOf)",
+                    Bench_IsValidNs(KEY_SEQ), Bench_IsValidNs(KEY_RAND), Bench_IsValidNs(KEY_MISS));
+    Bench_ReportRow("ENUM_DEFINE_TOSTRING_BATCH (per element)",
+                    Bench_BatchNs(KEY_SEQ), Bench_BatchNs(KEY_RAND), Bench_BatchNs(KEY_MISS));
+    Bench_ReportRow("ENUM_DEFINE_TOSTRING_VIEW",
+                    Bench_ViewNs(KEY_SEQ), Bench_ViewNs(KEY_RAND), Bench_ViewNs(KEY_MISS));
+    BENCH_FROMSTRING("ENUM_DEFINE_FROMSTRING", Bench_FromString);
+    BENCH_FROMSTRING("ENUM_DEFINE_FROMSTRING_TRIE (fold, strip)", Bench_FromTrie);
+    if (strcmp(BENCH_ENUM_LAYOUT, "bitset") == 0)
+    {
+        Bench_ReportRow("ENUM_DEFINE_FLAGS_TOSTRING (two bits)",
+                        Bench_FlagsNs(KEY_SEQ), Bench_FlagsNs(KEY_RAND), Bench_FlagsNs(KEY_MISS));
+    }
+    Bench_ReportRow("ENUM_DEFINE_ITERATOR (per element)", Bench_IteratorNs(), -1, -1);
+
+    return EXIT_SUCCESS;
+}
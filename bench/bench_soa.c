@@ -0,0 +1,69 @@
+/*
+ * Compares ENUM_DEFINE_TOSTRING over ENUM_IMPL with
+ * ENUM_DEFINE_TOSTRING_SOA over ENUM_IMPL_SOA for a 2,000 element sparse
+ * enum.
+ *
+ * Dedicated to the public domain. Use it as you wish.
+ */
+#include "bench.h"
+#include "bench_soa.h"
+
+#include <stdlib.h>
+
+#define OPS (1u << 18)
+
+typedef char const* (*ToString_f)(enum BENCH_SPARSE literal);
+
+static enum BENCH_SPARSE keys[OPS];
+
+/**
+ * Times @p f over every key, returning a checksum so the calls are kept.
+ */
+static unsigned Bench_Run(const char* name, ToString_f f)
+{
+    unsigned checksum = 0;
+    size_t idx;
+    double start = Bench_Seconds();
+
+    for (idx = 0; idx < OPS; ++idx)
+    {
+        checksum += (unsigned char) f(keys[idx])[0];
+    }
+
+    Bench_Report(name, Bench_Seconds() - start, OPS);
+    return checksum;
+}
+
+int main(void)
+{
+    uint64_t state = 88172645463325252ull;
+    size_t count = Bench_AosCount();
+    unsigned checksum = 0;
+    size_t idx;
+
+#if defined(__AVX2__) && !defined(ENUM_NO_SIMD)
+    printf("%zu element sparse enum, AVX2 search\n", count);
+#elif defined(__SSE2__) && !defined(ENUM_NO_SIMD)
+    printf("%zu element sparse enum, SSE2 search\n", count);
+#else
+    printf("%zu element sparse enum, scalar search\n", count);
+#endif
+
+    for (idx = 0; idx < OPS; ++idx)
+    {
+        keys[idx] = Bench_AosValueAt(Bench_Random(&state) % count);
+    }
+
+    checksum += Bench_Run("hit:  ENUM_DEFINE_TOSTRING (AoS)", Bench_AosToString);
+    checksum += Bench_Run("hit:  ENUM_DEFINE_TOSTRING_SOA", Bench_SoaToString);
+
+    for (idx = 0; idx < OPS; ++idx)
+    {
+        keys[idx] = (enum BENCH_SPARSE) -1 - (int) (Bench_Random(&state) % 1000);
+    }
+
+    checksum += Bench_Run("miss: ENUM_DEFINE_TOSTRING (AoS)", Bench_AosToString);
+    checksum += Bench_Run("miss: ENUM_DEFINE_TOSTRING_SOA", Bench_SoaToString);
+
+    return checksum == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,22 @@
+/*
+ * A 2,000 element sparse enum, searched through two table layouts.
+ *
+ * Dedicated to the public domain. Use it as you wish.
+ */
+#ifndef BENCH_SOA_H
+#define BENCH_SOA_H
+
+#include "enum.h"
+#include "gen/sparse_2000.h"
+
+ENUM(BENCH_SPARSE);
+
+/* bench_soa_aos.c: ENUM_IMPL and ENUM_DEFINE_TOSTRING */
+ENUM_DECLARE_TOSTRING(BENCH_SPARSE, Bench_AosToString);
+enum BENCH_SPARSE Bench_AosValueAt(size_t idx);
+size_t Bench_AosCount(void);
+
+/* bench_soa_soa.c: ENUM_IMPL_SOA and ENUM_DEFINE_TOSTRING_SOA */
+ENUM_DECLARE_TOSTRING(BENCH_SPARSE, Bench_SoaToString);
+
+#endif /* BENCH_SOA_H */
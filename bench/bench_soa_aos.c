@@ -0,0 +1,14 @@
+#include "bench_soa.h"
+
+ENUM_IMPL(BENCH_SPARSE);
+ENUM_DEFINE_TOSTRING(BENCH_SPARSE, Bench_AosToString)
+
+enum BENCH_SPARSE Bench_AosValueAt(size_t idx)
+{
+    return BENCH_SPARSE_ValueAt(idx);
+}
+
+size_t Bench_AosCount(void)
+{
+    return sizeof(BENCH_SPARSE_IMPL)/sizeof(*BENCH_SPARSE_IMPL);
+}
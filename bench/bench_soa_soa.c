@@ -0,0 +1,5 @@
+#include "bench_soa.h"
+#include "enum_soa.h"
+
+ENUM_IMPL_SOA(BENCH_SPARSE);
+ENUM_DEFINE_TOSTRING_SOA(BENCH_SPARSE, Bench_SoaToString)
@@ -0,0 +1,98 @@
+#!/bin/sh
+#
+# Generates a C-Enum list for benchmarks.
+#
+# Usage: gen_enum.sh NAME COUNT LAYOUT [prefixed]
+#
+#   contiguous  Values 0 .. COUNT - 1, in order.
+#   monotonic   Unique values scattered over [0, 1000 * COUNT), in order.
+#   sparse      Unique values scattered over [0, 1000 * COUNT), in random order.
+#   duplicate   Values drawn from COUNT / 4 + 1 multiples of 3, in random
+#               order, so most values have several elements.
+#   bitset      Single-bit values 1 << (i % 31), so unique up to 31 elements.
+#
+# Besides the list, NAME_LAYOUT, NAME_COUNT, NAME_CONTIGUOUS, NAME_MONOTONIC
+# and NAME_UNIQUE describe the generated values, so benchmarks can pick the
+# lookups which apply.
+#
+# The elements are named NAME_0 .. NAME_<COUNT - 1>. With "prefixed", the
+# list of suffixes 0 .. COUNT - 1 is generated as NAME_SUFFIXES, and NAME
+# is written from it with ENUM_PREFIX_LIST.
+#
+# Dedicated to the public domain. Use it as you wish.
+
+if [ $# -ne 3 ] && { [ $# -ne 4 ] || [ "$4" != prefixed ]; }; then
+    echo "usage: $0 NAME COUNT LAYOUT [prefixed]" >&2
+    exit 1
+fi
+
+awk -v name="$1" -v count="$2" -v layout="$3" -v prefixed="$4" '
+BEGIN {
+    srand(count);
+
+    if (layout == "contiguous") {
+        for (i = 0; i < count; i++) {
+            value[i] = i;
+        }
+    } else if (layout == "monotonic" || layout == "sparse") {
+        for (i = 0; i < count; i++) {
+            value[i] = i * 1000 + int(rand() * 1000);
+        }
+    } else if (layout == "duplicate") {
+        for (i = 0; i < count; i++) {
+            value[i] = int(rand() * (int(count / 4) + 1)) * 3;
+        }
+    } else if (layout == "bitset") {
+        for (i = 0; i < count; i++) {
+            value[i] = 2 ^ (i % 31);
+        }
+    } else {
+        print "unknown layout: " layout > "/dev/stderr";
+        exit 1;
+    }
+
+    if (layout == "sparse" || layout == "duplicate") {
+        for (i = count - 1; i > 0; i--) {
+            j = int(rand() * (i + 1));
+            t = value[i]; value[i] = value[j]; value[j] = t;
+        }
+    }
+
+    contiguous = 1;
+    monotonic = 1;
+    unique = 1;
+    for (i = 0; i < count; i++) {
+        if (i > 0 && value[i] != value[i - 1] + 1) {
+            contiguous = 0;
+        }
+        if (i > 0 && value[i] < value[i - 1]) {
+            monotonic = 0;
+        }
+        if (value[i] in seen) {
+            unique = 0;
+        }
+        seen[value[i]] = 1;
+    }
+
+    printf("/* Generated by gen_enum.sh %s %d %s */\n", name, count, layout);
+    printf("#define %s_LAYOUT \"%s\"\n", name, layout);
+    printf("#define %s_COUNT %d\n", name, count);
+    printf("#define %s_CONTIGUOUS %d\n", name, contiguous);
+    printf("#define %s_MONOTONIC %d\n", name, monotonic);
+    printf("#define %s_UNIQUE %d\n", name, unique);
+    printf("\n");
+    if (prefixed != "") {
+        printf("#define %s(_, _V, _S, _VS) ENUM_PREFIX_LIST(%s_, %s_SUFFIXES, _, _V, _S, _VS)\n", name, name, name);
+        printf("\n");
+        printf("#define %s_SUFFIXES(_, _V, _S, _VS) \\\n", name);
+        for (i = 0; i < count; i++) {
+            printf("    _V(%d, %d) \\\n", i, value[i]);
+        }
+    } else {
+        printf("#define %s(_, _V, _S, _VS) \\\n", name);
+        for (i = 0; i < count; i++) {
+            printf("    _V(%s_%d, %d) \\\n", name, i, value[i]);
+        }
+    }
+    printf("\n");
+}'
@@ -21,6 +21,10 @@
  * C-Enum goes further and lets you define iterator functions which can be used
  * to iterate over a discontinuous enumeration.
  *
+ * @section from_string Parsing
+ * The string table can be inverted, so names read from configuration files or
+ * text protocols can be mapped back to enum values.
+ *
  * In its current implementation, C-Enum is limited to enums containing at most
  * @p INT_MAX elements.
  *
@@ -58,7 +62,10 @@
 #ifndef ENUM_H
 #define ENUM_H
 
+#include <limits.h> // INT_MIN
 #include <stddef.h> // size_t, ptrdiff_t
+#include <stdint.h> // uint32_t, uint64_t
+#include <string.h> // memcmp, memcpy, strlen
 
 /**
  * Declares an enum @p e.
@@ -144,6 +151,145 @@
     ENUM(e); \
     typedef enum e t \
 
+/**
+ * Declares an enum @p e with the fixed-width storage type @p e_Storage_t.
+ *
+ * A field of type <tt>enum e</tt> takes the size the compiler chooses for
+ * the enum, usually that of an @p int. A field of type @p e_Storage_t
+ * takes the size of @p storage_t, so a struct with several such fields can
+ * be much smaller.
+ *
+ * It also emits the conversions @p e_ToStorage(literal) and
+ * @p e_FromStorage(stored). Compilation fails if the value of any element
+ * of @p e is not representable in @p storage_t.
+ *
+ * @param e A C-Enum list.
+ * @param storage_t An integer type, such as @p uint8_t.
+ *
+ * @note @p e_FromStorage does not check that @p stored is the value of an
+ *       element; see @ref ENUM_DEFINE_ISVALID.
+ * @see ENUM_STORAGE_BYTES
+ *
+ * @code
+ * ENUM_TYPED(SHAPE_POINTS, uint8_t);
+ *
+ * struct Outline
+ * {
+ *     SHAPE_POINTS_Storage_t inner;
+ *     SHAPE_POINTS_Storage_t outer;
+ * };
+ *
+ * outline.inner = SHAPE_POINTS_ToStorage(TRIANGLE);
+ * printf("%s\n", Shape_ToString(SHAPE_POINTS_FromStorage(outline.inner)));
+ * @endcode
+ *
+ */
+#define ENUM_TYPED(e, storage_t) \
+    ENUM(e); \
+    typedef storage_t e##_Storage_t; \
+    \
+    static inline e##_Storage_t e##_ToStorage(enum e literal) \
+    { \
+        typedef storage_t Enum_Storage_t; \
+        \
+        e(ENUM_STORAGE_CHECK, ENUM_STORAGE_CHECK, ENUM_STORAGE_CHECK, ENUM_STORAGE_CHECK) \
+        return (e##_Storage_t) literal; \
+    } \
+    \
+    static inline enum e e##_FromStorage(e##_Storage_t stored) \
+    { \
+        return (enum e) stored; \
+    } \
+    \
+    static inline enum e e##_FromStorage(e##_Storage_t stored) /* takes the closing semi-colon */
+
+/**
+ * Integer constant expression for the number of elements of the enum @p e.
+ *
+ * Equal to the element count of @p e_IMPL, but needs no table, so may size
+ * arrays in headers.
+ *
+ * @param e A C-Enum list.
+ *
+ * @code
+ * unsigned hits[ENUM_COUNT(SHAPE_POINTS)];
+ * @endcode
+ */
+#define ENUM_COUNT(e) \
+    (0 e(ENUM_COUNT_ONE, ENUM_COUNT_ONE, ENUM_COUNT_ONE, ENUM_COUNT_ONE))
+
+/**
+ * Declares the constants behind @ref ENUM_MIN_VALUE and @ref ENUM_MAX_VALUE
+ * for the enum @p e.
+ *
+ * C has no fold over a list, so the least and greatest values are carried
+ * through chains of enumerators, which must be declared before they can be
+ * read. Expand once per scope: for an enum shared between translation
+ * units, beside @ref ENUM_DECLARE_IMPL in its header, or in the one
+ * translation unit which expands @ref ENUM_DEFINE_IMPL_RANGE.
+ *
+ * @param e A C-Enum list.
+ *
+ * @note Values outside the range of @p int, which ISO C does not allow as
+ *       enumerators, are diagnosed by @p -pedantic.
+ *
+ * @code
+ * ENUM_TRAITS(SHAPE);
+ *
+ * static unsigned by_sides[ENUM_MAX_VALUE(SHAPE) + 1];
+ * @endcode
+ */
+#define ENUM_TRAITS(e) \
+    ENUM_MINMAX_ENUMERATORS(e) \
+
+/**
+ * Integer constant expression for the least value of the enum @p e.
+ *
+ * @param e A C-Enum list.
+ *
+ * @pre @ref ENUM_TRAITS of @p e is visible.
+ */
+#define ENUM_MIN_VALUE(e) \
+    ((0 e(ENUM_ANY_INT_MIN_LINK, ENUM_ANY_INT_MIN_LINK, ENUM_ANY_INT_MIN_LINK, ENUM_ANY_INT_MIN_LINK)) \
+        ? INT_MIN : e##_ENUM_MIN_END_)
+
+/**
+ * Integer constant expression for the greatest value of the enum @p e.
+ *
+ * @param e A C-Enum list.
+ *
+ * @pre @ref ENUM_TRAITS of @p e is visible.
+ */
+#define ENUM_MAX_VALUE(e) \
+    ((1 e(ENUM_ALL_INT_MIN_LINK, ENUM_ALL_INT_MIN_LINK, ENUM_ALL_INT_MIN_LINK, ENUM_ALL_INT_MIN_LINK)) \
+        ? INT_MIN : e##_ENUM_MAX_END_)
+
+/**
+ * Integer constant expression for the size, in bytes, of the smallest
+ * integer type which holds every value of the enum @p e: 1, 2, 4 or 8.
+ *
+ * The type is signed if @ref ENUM_MIN_VALUE is negative.
+ *
+ * @param e A C-Enum list.
+ *
+ * @pre @ref ENUM_TRAITS of @p e is visible.
+ *
+ * @code
+ * ENUM_TYPED(SHAPE, int8_t);
+ * ENUM_TRAITS(SHAPE);
+ *
+ * typedef char shape_storage_is_smallest[sizeof(SHAPE_Storage_t) == ENUM_STORAGE_BYTES(SHAPE) ? 1 : -1];
+ * @endcode
+ */
+#define ENUM_STORAGE_BYTES(e) \
+    ((long long) ENUM_MIN_VALUE(e) < 0 \
+     ? (ENUM_STORAGE_RANGE(e, INT8_MIN, INT8_MAX) ? 1 \
+        : ENUM_STORAGE_RANGE(e, INT16_MIN, INT16_MAX) ? 2 \
+        : ENUM_STORAGE_RANGE(e, INT32_MIN, INT32_MAX) ? 4 : 8) \
+     : (ENUM_STORAGE_RANGE(e, 0, UINT8_MAX) ? 1 \
+        : ENUM_STORAGE_RANGE(e, 0, UINT16_MAX) ? 2 \
+        : ENUM_STORAGE_RANGE(e, 0, UINT32_MAX) ? 4 : 8))
+
 /**
  * Allocates data table for the enum @p e.
  *
@@ -153,6 +299,13 @@
  * It emits @p e_IMPL, a static constant array of (value, "name")
  * pairs and an iterator typedef @p e_Iterator_t for the enum.
  *
+ * It also emits the table accessors @p e_ValueAt(idx), @p e_NameAt(idx) and
+ * @p e_NameLengthAt(idx), through which all ENUM_DEFINE_* functions read the
+ * table. The table stores no lengths, so @p e_NameLengthAt takes the
+ * @p strlen of the name. Alternative
+ * table layouts, such as @ref ENUM_IMPL_POOL, emit the same accessors and
+ * may be used in place of ENUM_IMPL.
+ *
  * The @p e_Iterator_t is a signed integer type.
  * It is incremented with the usual pre- or post- increment
  * operator.
@@ -181,7 +334,147 @@
     } e##_IMPL[] = \
     { \
         e(ENUM_IMPL_AS_NAME, ENUM_IMPL_AS_NAME_VALUE, ENUM_IMPL_AS_NAME_STRING, ENUM_IMPL_AS_NAME_VALUE_STRING) \
-    }
+    }; \
+    \
+    static inline enum e e##_ValueAt(size_t idx) \
+    { \
+        return e##_IMPL[idx].value; \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) \
+    { \
+        return e##_IMPL[idx].name; \
+    } \
+    \
+    static inline size_t e##_NameLengthAt(size_t idx) \
+    { \
+        return strlen(e##_IMPL[idx].name); \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) /* takes the closing semi-colon */
+
+/**
+ * Declares the shared data table of the enum @p e.
+ *
+ * The extern alternative to @ref ENUM_IMPL, for headers. @ref ENUM_IMPL
+ * defines a static table, so every translation unit which expands it keeps
+ * its own copy. ENUM_DECLARE_IMPL instead declares @p e_IMPL as an extern
+ * array, which @ref ENUM_DEFINE_IMPL defines once, so the ToString,
+ * iterator and other ENUM_DEFINE_* functions of every translation unit read
+ * the same table.
+ *
+ * It also declares the extern constants @p e_IMPL_COUNT, @p e_IMPL_MIN and
+ * @p e_IMPL_MAX, the element count and the least and greatest values, and
+ * emits the same @p e_Iterator_t and accessors as @ref ENUM_IMPL. The
+ * least and greatest values are only defined by @ref ENUM_DEFINE_IMPL_RANGE.
+ *
+ * @param e A C-Enum list.
+ *
+ * @note A required pre-declaration for all ENUM_DEFINE_* macros, in place of
+ *       @ref ENUM_IMPL.
+ *
+ * @code
+ * // shape.h
+ * ENUM(SHAPE);
+ * ENUM_DECLARE_IMPL(SHAPE);
+ *
+ * // shape.c
+ * ENUM_DEFINE_IMPL(SHAPE);
+ * @endcode
+ *
+ */
+#define ENUM_DECLARE_IMPL(e) \
+    typedef ptrdiff_t e##_Iterator_t; \
+    struct e##_PropertiesEntry \
+    { \
+        enum e value; \
+        const char* name; \
+    }; \
+    \
+    extern const struct e##_PropertiesEntry e##_IMPL[ENUM_COUNT(e)]; \
+    extern const size_t e##_IMPL_COUNT; \
+    extern const enum e e##_IMPL_MIN; \
+    extern const enum e e##_IMPL_MAX; \
+    \
+    static inline enum e e##_ValueAt(size_t idx) \
+    { \
+        return e##_IMPL[idx].value; \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) \
+    { \
+        return e##_IMPL[idx].name; \
+    } \
+    \
+    static inline size_t e##_NameLengthAt(size_t idx) \
+    { \
+        return strlen(e##_IMPL[idx].name); \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) /* takes the closing semi-colon */
+
+/**
+ * Defines the shared data table of the enum @p e.
+ *
+ * Defines @p e_IMPL and @p e_IMPL_COUNT, as declared by
+ * @ref ENUM_DECLARE_IMPL, in exactly one translation unit.
+ *
+ * @param e A C-Enum list.
+ *
+ * @pre @ref ENUM_DECLARE_IMPL declaration of @p e must be visible in the
+ *      current context.
+ *
+ * @code
+ * ENUM_DEFINE_IMPL(SHAPE);
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_IMPL(e) \
+    const struct e##_PropertiesEntry e##_IMPL[ENUM_COUNT(e)] = \
+    { \
+        e(ENUM_IMPL_AS_NAME, ENUM_IMPL_AS_NAME_VALUE, ENUM_IMPL_AS_NAME_STRING, ENUM_IMPL_AS_NAME_VALUE_STRING) \
+    }; \
+    \
+    const size_t e##_IMPL_COUNT = ENUM_COUNT(e) \
+
+/**
+ * Defines @p e_IMPL_MIN and @p e_IMPL_MAX, as declared by
+ * @ref ENUM_DECLARE_IMPL, in exactly one translation unit.
+ *
+ * Separate from @ref ENUM_DEFINE_IMPL as it needs @ref ENUM_TRAITS, whose
+ * enumerator chains grow the preprocessed output of a large enum tenfold.
+ *
+ * @param e A C-Enum list.
+ *
+ * @pre @ref ENUM_DECLARE_IMPL declaration and @ref ENUM_TRAITS of @p e must
+ *      be visible in the current context.
+ *
+ * @code
+ * ENUM_TRAITS(SHAPE);
+ * ENUM_DEFINE_IMPL_RANGE(SHAPE);
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_IMPL_RANGE(e) \
+    const enum e e##_IMPL_MIN = (enum e) ENUM_MIN_VALUE(e); \
+    const enum e e##_IMPL_MAX = (enum e) ENUM_MAX_VALUE(e) \
+
+/**
+ * String returned by ToString functions for a value which is not an element
+ * of the enum.
+ */
+#define ENUM_UNKNOWN_STRING "ERROR: UNKNOWN ENUM TYPE"
+
+/**
+ * A name and its length, as returned by string-view ToString functions.
+ *
+ * @p ptr is NUL terminated, so may also be used as a C string.
+ */
+struct Enum_StringView
+{
+    char const* ptr;
+    size_t len;
+};
 
 /**
  * Emit a ToString function declaration @p fname for the enum @p e.
@@ -217,13 +510,197 @@
         \
         for (idx = 0; idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL); ++idx) \
         { \
-            if ((literal) == e##_IMPL[idx].value) \
+            if ((literal) == e##_ValueAt(idx)) \
+            { \
+                return e##_NameAt(idx); \
+            } \
+        } \
+        \
+        return ENUM_UNKNOWN_STRING; \
+    } \
+
+/**
+ * Emit a switch-based ToString function definition @p fname for the enum @p e.
+ *
+ * Returns the same strings as @ref ENUM_DEFINE_TOSTRING, but expands the
+ * C-Enum list into the arms of a @p switch statement rather than scanning
+ * @p e_IMPL at run time. The compiler is then free to emit a jump table, a
+ * lookup table or a decision tree, whichever suits the enum's values.
+ *
+ * @param e An enum name.
+ * @param fname of ToString function.
+ *
+ * @note No closing semi-colon.
+ * @note Does not require @ref ENUM_IMPL.
+ * @note Elements sharing a value are duplicate case labels, so are rejected
+ *       at compile time rather than printed with the wrong name. (Issue #1)
+ *
+ * @code
+ * ENUM_DEFINE_TOSTRING_SWITCH(SHAPE_POINTS, Shape_ToString)
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_TOSTRING_SWITCH(e, fname) \
+    ENUM_DECLARE_TOSTRING(e, fname) \
+    { \
+        switch (literal) \
+        { \
+            e(ENUM_CASE_AS_NAME, ENUM_CASE_AS_NAME_VALUE, ENUM_CASE_AS_NAME_STRING, ENUM_CASE_AS_NAME_VALUE_STRING) \
+            default: \
+                break; \
+        } \
+        \
+        return ENUM_UNKNOWN_STRING; \
+    } \
+
+/**
+ * Emit a string-view ToString function declaration @p fname for the enum
+ * @p e.
+ */
+#define ENUM_DECLARE_TOSTRING_VIEW(e, fname) \
+        struct Enum_StringView fname(enum e literal)
+
+/**
+ * Emit a string-view ToString function definition @p fname for the enum
+ * @p e.
+ *
+ * Returns the same names as @ref ENUM_DEFINE_TOSTRING, with their lengths
+ * from @p e_NameLengthAt. A caller can then copy a name with one
+ * @p memcpy. The pool, structure-of-arrays, hot/cold and prefix layouts
+ * store the lengths at compile time, so no @p strlen is needed;
+ * @ref ENUM_IMPL takes one for each name.
+ *
+ * @param e An enum name.
+ * @param fname of string-view ToString function.
+ * @param indexof An IndexOf function for @p e, such as one from
+ *                @ref ENUM_DEFINE_INDEXOF.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_IMPL_POOL(SHAPE_POINTS, uint16_t);
+ * ENUM_DEFINE_INDEXOF(SHAPE_POINTS, Shape_IndexOf)
+ * ENUM_DEFINE_TOSTRING_VIEW(SHAPE_POINTS, Shape_ToStringView, Shape_IndexOf)
+ *
+ * struct Enum_StringView name = Shape_ToStringView(TETRAGON);
+ * fwrite(name.ptr, 1, name.len, stdout);
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_TOSTRING_VIEW(e, fname, indexof) \
+    ENUM_DECLARE_TOSTRING_VIEW(e, fname) \
+    { \
+        e##_Iterator_t idx = indexof(literal); \
+        struct Enum_StringView view = {ENUM_UNKNOWN_STRING, sizeof(ENUM_UNKNOWN_STRING) - 1}; \
+        \
+        if (idx != ENUM_INDEX_UNKNOWN) \
+        { \
+            view.ptr = e##_NameAt((size_t) idx); \
+            view.len = e##_NameLengthAt((size_t) idx); \
+        } \
+        \
+        return view; \
+    } \
+
+/*************************************************************************
+ * FromString
+ *************************************************************************/
+/**
+ * Emit a FromString function declaration @p fname for the enum @p e.
+ *
+ * @param e     C-Enum Name.
+ * @param fname FromString function name.
+ */
+#define ENUM_DECLARE_FROMSTRING(e, fname) \
+    enum ENUM_STATUS fname(char const* str, size_t len, enum e* literal)
+
+/**
+ * Emit a FromString function definition @p fname for the enum @p e.
+ *
+ * The function is the inverse of the ToString functions: it maps the @p len
+ * characters at @p str, which need not be NUL terminated, to the value of the
+ * element with that name and stores it in @p *literal.
+ *
+ * Lookups hash the name once and probe an open-addressed table built from
+ * @p e_IMPL, so take expected O(1) time regardless of the enum's size.
+ *
+ * @param e An enum name.
+ * @param fname of FromString function.
+ *
+ * @return @ref ENUM_OK, or @ref ENUM_E_UNKNOWN if no element has the name, in
+ *         which case @p *literal is unchanged.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ *
+ * @note No closing semi-colon.
+ * @note If several elements share a name, the first one is found.
+ * @note With GCC and Clang the table is built before @p main runs. Other
+ *       compilers build it on the first call, which must not race with
+ *       other calls.
+ *
+ * @code
+ * ENUM_IMPL(SHAPE_POINTS);
+ * ...
+ * ENUM_DEFINE_FROMSTRING(SHAPE_POINTS, Shape_FromString)
+ *
+ * enum SHAPE_POINTS points;
+ *
+ * if (Shape_FromString(token, token_len, &points) != ENUM_OK)
+ * {
+ *     printf("Unknown shape %.*s\n", (int) token_len, token);
+ * }
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_FROMSTRING(e, fname) \
+    static struct Enum_HashSlot fname##_HASH[ENUM_HASH_SIZE(sizeof(e##_IMPL)/sizeof(*e##_IMPL))]; \
+    static int fname##_HASH_BUILT; \
+    \
+    ENUM_AT_LOAD static void fname##_HashInit(void) \
+    { \
+        size_t idx = 0; \
+        \
+        for (idx = 0; idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL); ++idx) \
+        { \
+            size_t len = e##_NameLengthAt(idx); \
+            size_t slot = Enum_HashProbe(fname##_HASH, \
+                                         sizeof(fname##_HASH)/sizeof(*fname##_HASH), \
+                                         e##_NameAt(idx), \
+                                         len); \
+            \
+            if (fname##_HASH[slot].index == 0) \
             { \
-                return e##_IMPL[idx].name; \
+                fname##_HASH[slot].hash = Enum_Hash(e##_NameAt(idx), len); \
+                fname##_HASH[slot].length = (uint32_t) len; \
+                fname##_HASH[slot].name = e##_NameAt(idx); \
+                fname##_HASH[slot].index = idx + 1; \
             } \
         } \
         \
-        return "ERROR: UNKNOWN ENUM TYPE"; \
+        fname##_HASH_BUILT = 1; \
+    } \
+    \
+    ENUM_DECLARE_FROMSTRING(e, fname) \
+    { \
+        size_t slot = 0; \
+        \
+        if (!fname##_HASH_BUILT) \
+        { \
+            fname##_HashInit(); \
+        } \
+        \
+        slot = Enum_HashProbe(fname##_HASH, \
+                              sizeof(fname##_HASH)/sizeof(*fname##_HASH), \
+                              str, \
+                              len); \
+        \
+        if (fname##_HASH[slot].index == 0) \
+        { \
+            return ENUM_E_UNKNOWN; \
+        } \
+        \
+        *(literal) = e##_ValueAt(fname##_HASH[slot].index - 1); \
+        return ENUM_OK; \
     } \
 
 /*************************************************************************
@@ -300,9 +777,36 @@
     \
     enum e tovalue(e##_Iterator_t iter) \
     { \
-        return e##_IMPL[iter].value; \
+        return e##_ValueAt(iter); \
     } \
 
+/**
+ * Index returned by IndexOf functions for a value which is not an element
+ * of the enum.
+ *
+ * Never a valid iterator, since iterators count up from zero.
+ */
+#define ENUM_INDEX_UNKNOWN ((ptrdiff_t) -1)
+
+/**
+ * Emit an IndexOf function declaration @p fname for the enum @p e.
+ *
+ * An IndexOf function is the inverse of an iterator's @p tovalue function,
+ * mapping an enum value to the iterator of its (first) element, or
+ * @ref ENUM_INDEX_UNKNOWN.
+ *
+ * @param e     C-Enum Name.
+ * @param fname IndexOf function name.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ *
+ * @code
+ * ENUM_DECLARE_INDEXOF(SHAPE, Shape_IndexOf);
+ * @endcode
+ */
+#define ENUM_DECLARE_INDEXOF(e, fname) \
+    e##_Iterator_t fname(enum e literal) \
+
 /*************************************************************************
  * Internal macros
  *************************************************************************/
@@ -421,10 +925,379 @@
  */
 #define ENUM_IMPL_AS_NAME_VALUE_STRING(name, unused_value, string) {(name), string},
 
+/**
+ * Internal X-Macro which emits a @p case returning @p "name".
+ *
+ * @param name An enum element name
+ *
+ * @code
+ * ENUM_CASE_AS_NAME(SIDES_OF_A_TRIANGLE)
+ *      => case (SIDES_OF_A_TRIANGLE): return "SIDES_OF_A_TRIANGLE";
+ * @endcode
+ */
+#define ENUM_CASE_AS_NAME(name) case (name): return #name;
+
+/**
+ * Internal X-Macro which emits a @p case returning @p "name".
+ *
+ * @param name An enum element name
+ * @param unused_value Unused constant integer expression.
+ *
+ * @code
+ * ENUM_CASE_AS_NAME_VALUE(SIDES_OF_A_TRIANGLE, 3)
+ *      => case (SIDES_OF_A_TRIANGLE): return "SIDES_OF_A_TRIANGLE";
+ * @endcode
+ */
+#define ENUM_CASE_AS_NAME_VALUE(name, unused_value) case (name): return #name;
+
+/**
+ * Internal X-Macro which emits a @p case returning @p string.
+ *
+ * @param name An enum element name
+ * @param string Descriptive string assigned to the enum element name
+ *
+ * @code
+ * ENUM_CASE_AS_NAME_STRING(SIDES_OF_A_TRIANGLE, "Sides of a Triangle")
+ *      => case (SIDES_OF_A_TRIANGLE): return "Sides of a Triangle";
+ * @endcode
+ */
+#define ENUM_CASE_AS_NAME_STRING(name, string) case (name): return string;
+
+/**
+ * Internal X-Macro which emits a @p case returning @p string.
+ *
+ * @param name An enum element name
+ * @param unused_value Unused constant integer expression.
+ * @param string Descriptive string assigned to the enum element name
+ *
+ * @code
+ * ENUM_CASE_AS_NAME_VALUE_STRING(SIDES_OF_A_TRIANGLE, 3, "Sides of a Triangle")
+ *      => case (SIDES_OF_A_TRIANGLE): return "Sides of a Triangle";
+ * @endcode
+ */
+#define ENUM_CASE_AS_NAME_VALUE_STRING(name, unused_value, string) case (name): return string;
+
+/**
+ * Internal helper which yields the first argument of a C-Enum tuple.
+ *
+ * Lets a single variadic X-Macro stand in for all four tuple forms when only
+ * the element name is needed.
+ *
+ * @code
+ * ENUM_NAME_OF(OCTAGON, 8, "Sides of an Octagon") => OCTAGON
+ * @endcode
+ */
+#define ENUM_NAME_OF(...) ENUM_NAME_OF_I(__VA_ARGS__, ~)
+#define ENUM_NAME_OF_I(name, ...) name
+
+/**
+ * Internal integer constant expression which is non-zero if the integer
+ * constant expression @p value is representable in the integer type
+ * @p storage_t.
+ *
+ * @p storage_t is signed if its -1 is less than 1, which unlike a test
+ * against 0 is not diagnosed by @p -Wtype-limits for unsigned types.
+ */
+#define ENUM_STORAGE_FITS(storage_t, value) \
+    ((long long) (storage_t) (value) == (long long) (value) \
+     && ((long long) (value) >= 0 || (storage_t) -1 < 1))
+
+/**
+ * Internal integer constant expression which is non-zero if the values of
+ * the enum @p e lie in [@p lo, @p hi].
+ */
+#define ENUM_STORAGE_RANGE(e, lo, hi) \
+    ((long long) ENUM_MIN_VALUE(e) >= (long long) (lo) && (long long) ENUM_MAX_VALUE(e) <= (long long) (hi))
+
+/**
+ * Internal X-Macro which fails compilation if the value of the element is
+ * not representable in @p Enum_Storage_t, a typedef in the enclosing scope.
+ *
+ * @see ENUM_TYPED
+ */
+#define ENUM_STORAGE_CHECK(...) \
+    ENUM_STATIC_ASSERT(ENUM_STORAGE_FITS(Enum_Storage_t, ENUM_NAME_OF(__VA_ARGS__)));
+
+/**
+ * Internal X-Macro which emits <tt>+ 1</tt> for every element.
+ *
+ * @see ENUM_COUNT
+ */
+#define ENUM_COUNT_ONE(...) + 1
+
+/**
+ * Internal X-Macro link which emits <tt>name) + 0 * (</tt>.
+ *
+ * @see ENUM_FIRST_VALUE
+ */
+#define ENUM_FIRST_VALUE_LINK(...) ENUM_NAME_OF(__VA_ARGS__)) + 0 * (
+
+/**
+ * Internal X-Macro link which emits <tt>) * 0 + (name</tt>.
+ *
+ * @see ENUM_LAST_VALUE
+ */
+#define ENUM_LAST_VALUE_LINK(...) ) * 0 + (ENUM_NAME_OF(__VA_ARGS__)
+
+/**
+ * Integer constant expression for the value of the first element of @p e.
+ *
+ * @code
+ * ENUM_FIRST_VALUE(SHAPE) => ((ANTI_LINE) + 0 * (POINT) + ... + 0 * (0))
+ * @endcode
+ */
+#define ENUM_FIRST_VALUE(e) \
+    (( \
+        e(ENUM_FIRST_VALUE_LINK, ENUM_FIRST_VALUE_LINK, ENUM_FIRST_VALUE_LINK, ENUM_FIRST_VALUE_LINK) \
+    0))
+
+/**
+ * Integer constant expression for the value of the last element of @p e.
+ *
+ * @code
+ * ENUM_LAST_VALUE(SHAPE) => ((0) * 0 + (ANTI_LINE) * 0 + ... + (OCTAGON))
+ * @endcode
+ */
+#define ENUM_LAST_VALUE(e) \
+    ((0 \
+        e(ENUM_LAST_VALUE_LINK, ENUM_LAST_VALUE_LINK, ENUM_LAST_VALUE_LINK, ENUM_LAST_VALUE_LINK) \
+    ))
+
+/**
+ * Internal value for an enumerator whose implicit successor is @p acc.
+ *
+ * @p acc - 1, except at @p INT_MIN, where it is @p INT_MIN so the successor
+ * does not overflow. The successor is then biased up by one, which
+ * @ref ENUM_MIN_VALUE and @ref ENUM_MAX_VALUE correct.
+ */
+#define ENUM_MINMAX_TAIL(acc) ((acc) == INT_MIN ? INT_MIN : (acc) - 1)
+
+/**
+ * Internal X-Macro which emits the running minimum up to element @p name.
+ *
+ * A folded minimum must refer to the previous one, which C's preprocessor
+ * cannot name. An enumerator without an initializer is one more than the
+ * enumerator before it, so each step ends with <tt>name_ENUM_MIN_TAIL_</tt>,
+ * one less than the running minimum, and the next step reads it back as its
+ * implicit <tt>name_ENUM_MIN_PREV_</tt>.
+ */
+#define ENUM_MIN_LINK(...) ENUM_MIN_LINK_I(ENUM_NAME_OF(__VA_ARGS__))
+#define ENUM_MIN_LINK_I(name) ENUM_MIN_LINK_II(name)
+#define ENUM_MIN_LINK_II(name) \
+    name##_ENUM_MIN_PREV_, \
+    name##_ENUM_MIN_ = ((long long) (name) < name##_ENUM_MIN_PREV_ ? (long long) (name) : name##_ENUM_MIN_PREV_), \
+    name##_ENUM_MIN_TAIL_ = ENUM_MINMAX_TAIL(name##_ENUM_MIN_),
+
+/**
+ * Internal X-Macro which emits the running maximum up to element @p name.
+ *
+ * @see ENUM_MIN_LINK
+ */
+#define ENUM_MAX_LINK(...) ENUM_MAX_LINK_I(ENUM_NAME_OF(__VA_ARGS__))
+#define ENUM_MAX_LINK_I(name) ENUM_MAX_LINK_II(name)
+#define ENUM_MAX_LINK_II(name) \
+    name##_ENUM_MAX_PREV_, \
+    name##_ENUM_MAX_ = ((long long) (name) > name##_ENUM_MAX_PREV_ ? (long long) (name) : name##_ENUM_MAX_PREV_), \
+    name##_ENUM_MAX_TAIL_ = ENUM_MINMAX_TAIL(name##_ENUM_MAX_),
+
+/**
+ * Internal X-Macro link which emits <tt>|| (name) == INT_MIN</tt>.
+ */
+#define ENUM_ANY_INT_MIN_LINK(...) || (long long) (ENUM_NAME_OF(__VA_ARGS__)) == INT_MIN
+
+/**
+ * Internal X-Macro link which emits <tt>&& (name) == INT_MIN</tt>.
+ */
+#define ENUM_ALL_INT_MIN_LINK(...) && (long long) (ENUM_NAME_OF(__VA_ARGS__)) == INT_MIN
+
+/**
+ * Internal declaration of the enumerators from which @ref ENUM_MIN_VALUE
+ * and @ref ENUM_MAX_VALUE read the least and greatest values of @p e.
+ *
+ * Emits three enumerators per element and per fold.
+ */
+#define ENUM_MINMAX_ENUMERATORS(e) \
+    enum \
+    { \
+        e##_ENUM_MIN_SEED_ = ENUM_MINMAX_TAIL(ENUM_FIRST_VALUE(e)), \
+        e(ENUM_MIN_LINK, ENUM_MIN_LINK, ENUM_MIN_LINK, ENUM_MIN_LINK) \
+        e##_ENUM_MIN_END_ \
+    }; \
+    \
+    enum \
+    { \
+        e##_ENUM_MAX_SEED_ = ENUM_MINMAX_TAIL(ENUM_FIRST_VALUE(e)), \
+        e(ENUM_MAX_LINK, ENUM_MAX_LINK, ENUM_MAX_LINK, ENUM_MAX_LINK) \
+        e##_ENUM_MAX_END_ \
+    } \
+
+/**
+ * Internal helper which fails compilation when the integer constant
+ * expression @p cond is false. Usable as a statement.
+ */
+#define ENUM_STATIC_ASSERT(cond) ((void) sizeof(char[(cond) ? 1 : -1]))
+
+/**
+ * Internal integer constant expression for <tt>ceil(log2(n))</tt>, for
+ * 0 < @p n <= 2^31.
+ */
+#define ENUM_CEIL_LOG2(n) \
+    (((n) > 0x1ul) + ((n) > 0x2ul) + ((n) > 0x4ul) + ((n) > 0x8ul) \
+     + ((n) > 0x10ul) + ((n) > 0x20ul) + ((n) > 0x40ul) + ((n) > 0x80ul) \
+     + ((n) > 0x100ul) + ((n) > 0x200ul) + ((n) > 0x400ul) + ((n) > 0x800ul) \
+     + ((n) > 0x1000ul) + ((n) > 0x2000ul) + ((n) > 0x4000ul) + ((n) > 0x8000ul) \
+     + ((n) > 0x10000ul) + ((n) > 0x20000ul) + ((n) > 0x40000ul) + ((n) > 0x80000ul) \
+     + ((n) > 0x100000ul) + ((n) > 0x200000ul) + ((n) > 0x400000ul) + ((n) > 0x800000ul) \
+     + ((n) > 0x1000000ul) + ((n) > 0x2000000ul) + ((n) > 0x4000000ul) + ((n) > 0x8000000ul) \
+     + ((n) > 0x10000000ul) + ((n) > 0x20000000ul) + ((n) > 0x40000000ul) + ((n) > 0x80000000ul))
+
+/**
+ * Internal attribute which runs a static initialisation function before
+ * @p main, where the compiler supports it.
+ *
+ * Define @p ENUM_NO_AT_LOAD to defer all initialisation to first use.
+ */
+#if defined(__GNUC__) && !defined(ENUM_NO_AT_LOAD)
+#define ENUM_AT_LOAD __attribute__((constructor))
+#else
+#define ENUM_AT_LOAD
+#endif
+
+/**
+ * Internal slot count of a hash table for @p n names: a power of two of at
+ * least 2 @p n, keeping the load factor at or below one half.
+ */
+#define ENUM_HASH_SIZE(n) ((size_t) 2 << ENUM_CEIL_LOG2(n))
+
+/**
+ * Internal open-addressed hash table slot.
+ */
+struct Enum_HashSlot
+{
+    uint32_t hash;    /**< Hash of the name. */
+    uint32_t length;  /**< Length of the name. */
+    char const* name; /**< The name. */
+    size_t index;     /**< One plus the name's table index, or 0 if empty. */
+};
+
+/**
+ * Internal count of trailing zero bits of the non-zero @p bits.
+ */
+static inline unsigned Enum_Ctz64(uint64_t bits)
+{
+#if defined(__GNUC__)
+    return (unsigned) __builtin_ctzll(bits);
+#else
+    unsigned count = 0;
+
+    while (!(bits & 1u))
+    {
+        bits >>= 1;
+        count++;
+    }
+
+    return count;
+#endif
+}
+
+/**
+ * Internal count of set bits of @p bits.
+ */
+static inline unsigned Enum_Popcount64(uint64_t bits)
+{
+#if defined(__GNUC__)
+    return (unsigned) __builtin_popcountll(bits);
+#else
+    bits = bits - ((bits >> 1) & UINT64_C(0x5555555555555555));
+    bits = (bits & UINT64_C(0x3333333333333333)) + ((bits >> 2) & UINT64_C(0x3333333333333333));
+    bits = (bits + (bits >> 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+
+    return (unsigned) ((bits * UINT64_C(0x0101010101010101)) >> 56);
+#endif
+}
+
+/**
+ * Internal 32-bit FNV-1a hash of the @p len characters at @p str.
+ */
+static inline uint32_t Enum_Hash(char const* str, size_t len)
+{
+    uint32_t hash = 2166136261u;
+    size_t idx = 0;
+
+    for (idx = 0; idx < len; ++idx)
+    {
+        hash = (hash ^ (unsigned char) str[idx]) * 16777619u;
+    }
+
+    return hash;
+}
+
+/**
+ * Internal probe of the @p size slot hash table @p slots for the @p len
+ * characters at @p str.
+ *
+ * @return The index of the slot holding the name, or of the empty slot
+ *         where it would be inserted.
+ */
+static inline size_t Enum_HashProbe(struct Enum_HashSlot const* slots,
+                                    size_t size,
+                                    char const* str,
+                                    size_t len)
+{
+    uint32_t hash = Enum_Hash(str, len);
+    size_t slot = 0;
+
+    for (slot = hash & (size - 1); slots[slot].index != 0; slot = (slot + 1) & (size - 1))
+    {
+        if (slots[slot].hash == hash
+            && slots[slot].length == len
+            && memcmp(slots[slot].name, str, len) == 0)
+        {
+            break;
+        }
+    }
+
+    return slot;
+}
+
+/**
+ * Internal copy of the @p len characters at @p str to @p buf at @p at, as
+ * far as they fit before the last byte of @p buf, which is @p size bytes long.
+ *
+ * @return @p len, so lengths add up as if nothing were truncated, as for
+ *         @p snprintf.
+ */
+static inline size_t Enum_Append(char* buf, size_t size, size_t at, char const* str, size_t len)
+{
+    if (at + 1 < size)
+    {
+        memcpy(buf + at, str, (size - 1 - at) < len ? (size - 1 - at) : len);
+    }
+
+    return len;
+}
+
 /**
  *     @} // addtogroup Internal
  */
 
+/*************************************************************************
+ * Status codes
+ *************************************************************************/
+/**
+ * Status codes returned by C-Enum functions which can fail.
+ */
+#define ENUM_STATUS(_, _V, _S, _VS) \
+    _VS(ENUM_OK, 0, "OK") \
+    _VS(ENUM_E_UNKNOWN, -1, "Unknown enum name") \
+    _VS(ENUM_E_SYNTAX, -2, "Malformed enum expression") \
+    _VS(ENUM_E_AMBIGUOUS, -3, "Ambiguous enum name") \
+
+/**
+ * The C-Enum status code enum, itself a C-Enum.
+ */
+ENUM(ENUM_STATUS);
+
 #endif /* ENUM_H */
 
 /**
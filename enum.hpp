@@ -0,0 +1,244 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Compile-time C++17 tables and lookups for C-Enum definitions.
+ *
+ * @ref ENUM_IMPL_CONSTEXPR expands the same X-macro list as @ref ENUM_IMPL
+ * into a @p constexpr table, so the @p cenum functions below can be evaluated
+ * by the compiler when their arguments are constant, and checked with
+ * @p static_assert.
+ *
+ * The C macros in enum.h are unchanged and may be used alongside.
+ *
+ * @code
+ * ENUM(SHAPE);
+ * ENUM_IMPL_CONSTEXPR(SHAPE);
+ *
+ * static_assert(cenum::count<enum SHAPE> == 6);
+ * static_assert(cenum::to_string(TRIANGLE) == "TRIANGLE");
+ * static_assert(*cenum::from_string<enum SHAPE>("POINT") == POINT);
+ *
+ * for (enum SHAPE shape : cenum::values<enum SHAPE>)
+ * {
+ *     std::cout << cenum::to_string(shape) << '\n';
+ * }
+ * @endcode
+ *
+ */
+#ifndef ENUM_HPP
+#define ENUM_HPP
+
+#include "enum.h"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+/**
+ * Emits the @p constexpr table for the enum @p e.
+ *
+ * The C++ counterpart of @ref ENUM_IMPL. It emits a @p e_Constexpr traits
+ * struct and a @p CEnumTraits overload through which the @p cenum functions
+ * find it by argument-dependent lookup, so it may be used in any namespace
+ * which declares the enum.
+ *
+ * @param e A C-Enum list.
+ *
+ * @code
+ * ENUM_IMPL_CONSTEXPR(SHAPE_POINTS);
+ * @endcode
+ *
+ */
+#define ENUM_IMPL_CONSTEXPR(e) \
+    struct e##_Constexpr \
+    { \
+        static constexpr ::cenum::Entry<enum e> table[] = \
+        { \
+            e(ENUM_IMPL_AS_NAME, ENUM_IMPL_AS_NAME_VALUE, ENUM_IMPL_AS_NAME_STRING, ENUM_IMPL_AS_NAME_VALUE_STRING) \
+        }; \
+    }; \
+    \
+    constexpr e##_Constexpr CEnumTraits(enum e) noexcept \
+    { \
+        return {}; \
+    } \
+
+
+namespace cenum
+{
+
+/**
+ * A (value, name) table entry, as in @p e_IMPL.
+ */
+template <typename E>
+struct Entry
+{
+    E value;
+    std::string_view name;
+};
+
+/**
+ * The traits struct emitted by @ref ENUM_IMPL_CONSTEXPR for @p E.
+ */
+template <typename E>
+using Traits = decltype(CEnumTraits(E{}));
+
+/**
+ * The (value, name) table of @p E, in declaration order.
+ */
+template <typename E>
+constexpr auto& entries = Traits<E>::table;
+
+/**
+ * The number of elements of @p E.
+ */
+template <typename E>
+constexpr std::size_t count = std::size(Traits<E>::table);
+
+namespace detail
+{
+
+template <typename E>
+constexpr std::array<E, count<E>> make_values() noexcept
+{
+    std::array<E, count<E>> values{};
+
+    for (std::size_t idx = 0; idx < count<E>; ++idx)
+    {
+        values[idx] = entries<E>[idx].value;
+    }
+
+    return values;
+}
+
+template <typename E>
+constexpr std::array<std::string_view, count<E>> make_names() noexcept
+{
+    std::array<std::string_view, count<E>> names{};
+
+    for (std::size_t idx = 0; idx < count<E>; ++idx)
+    {
+        names[idx] = entries<E>[idx].name;
+    }
+
+    return names;
+}
+
+} // namespace detail
+
+/**
+ * The values of @p E in declaration order, for range-for iteration.
+ */
+template <typename E>
+constexpr std::array<E, count<E>> values = detail::make_values<E>();
+
+/**
+ * The names of @p E in declaration order.
+ */
+template <typename E>
+constexpr std::array<std::string_view, count<E>> names = detail::make_names<E>();
+
+/**
+ * Whether the values of @p E never decrease in declaration order.
+ */
+template <typename E>
+constexpr bool is_monotonic() noexcept
+{
+    for (std::size_t idx = 1; idx < count<E>; ++idx)
+    {
+        if (values<E>[idx] < values<E>[idx - 1])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Whether the values of @p E are <tt>[base, base + N)</tt> in declaration
+ * order.
+ */
+template <typename E>
+constexpr bool is_contiguous() noexcept
+{
+    for (std::size_t idx = 1; idx < count<E>; ++idx)
+    {
+        if (static_cast<long long>(values<E>[idx]) != static_cast<long long>(values<E>[idx - 1]) + 1)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * The index of the first element of @p E with value @p literal, or
+ * @ref ENUM_INDEX_UNKNOWN.
+ */
+template <typename E>
+constexpr std::ptrdiff_t index_of(E literal) noexcept
+{
+    if constexpr (is_contiguous<E>())
+    {
+        std::size_t idx = static_cast<std::size_t>(literal) - static_cast<std::size_t>(values<E>[0]);
+
+        return idx < count<E> ? static_cast<std::ptrdiff_t>(idx) : ENUM_INDEX_UNKNOWN;
+    }
+    else
+    {
+        for (std::size_t idx = 0; idx < count<E>; ++idx)
+        {
+            if (values<E>[idx] == literal)
+            {
+                return static_cast<std::ptrdiff_t>(idx);
+            }
+        }
+
+        return ENUM_INDEX_UNKNOWN;
+    }
+}
+
+/**
+ * The name of the first element of @p E with value @p literal, or
+ * @ref ENUM_UNKNOWN_STRING.
+ */
+template <typename E>
+constexpr std::string_view to_string(E literal) noexcept
+{
+    std::ptrdiff_t idx = index_of(literal);
+
+    return idx == ENUM_INDEX_UNKNOWN ? ENUM_UNKNOWN_STRING : names<E>[idx];
+}
+
+/**
+ * The value of the first element of @p E named @p name, or @p std::nullopt.
+ */
+template <typename E>
+constexpr std::optional<E> from_string(std::string_view name) noexcept
+{
+    for (std::size_t idx = 0; idx < count<E>; ++idx)
+    {
+        if (names<E>[idx] == name)
+        {
+            return values<E>[idx];
+        }
+    }
+
+    return std::nullopt;
+}
+
+} // namespace cenum
+
+#endif /* ENUM_HPP */
+
+/**
+ * @} // addtogroup C-Enum
+ */
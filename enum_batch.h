@@ -0,0 +1,242 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Batch ToString and IndexOf over arrays of enum values.
+ *
+ * Converting a large array of values one call at a time repeats the table
+ * search for every element. The batch functions amortise that work across
+ * the array:
+ *
+ * - When the enum's values span at most @ref ENUM_BATCH_DENSE_MAX integers,
+ *   a dense value-to-index map is built once, on load under GCC compatible
+ *   compilers, otherwise on the first call, as for
+ *   @ref ENUM_DEFINE_FROMSTRING. Each element then costs one bounds check
+ *   and one load, however short the array.
+ * - Otherwise each element is looked up with an IndexOf function chosen by
+ *   the caller, such as one from @ref ENUM_DEFINE_INDEXOF or
+ *   @ref ENUM_DEFINE_INDEXOF_SOA, and runs of equal values are looked up once.
+ *
+ * Unknown values are reported per element, and counted in the return value.
+ *
+ */
+#ifndef ENUM_BATCH_H
+#define ENUM_BATCH_H
+
+#include "enum.h"
+
+/**
+ * The widest value range, in integers, for which batch functions build a
+ * dense map. The map takes four bytes per integer of static storage, of
+ * which only the enum's range is ever written.
+ */
+#ifndef ENUM_BATCH_DENSE_MAX
+#define ENUM_BATCH_DENSE_MAX 4096
+#endif
+
+/**
+ * Emit a batch ToString function declaration @p fname for the enum @p e.
+ *
+ * @param e     C-Enum Name.
+ * @param fname Batch ToString function name.
+ */
+#define ENUM_DECLARE_TOSTRING_BATCH(e, fname) \
+    size_t fname(enum e const* in, size_t n, char const** out)
+
+/**
+ * Emit a batch IndexOf function declaration @p fname for the enum @p e.
+ *
+ * @param e     C-Enum Name.
+ * @param fname Batch IndexOf function name.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ */
+#define ENUM_DECLARE_INDEXOF_BATCH(e, fname) \
+    size_t fname(enum e const* in, size_t n, e##_Iterator_t* out)
+
+/**
+ * Emit a batch ToString function definition @p fname for the enum @p e.
+ *
+ * The function stores the name of each of the @p n values at @p in to the
+ * same position at @p out, or @p NULL if the value is not an element.
+ *
+ * @param e       An enum name.
+ * @param fname   of batch ToString function.
+ * @param indexof An IndexOf function for @p e, used when no dense map is
+ *                built.
+ *
+ * @return The number of unknown values.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_IMPL(ERROR);
+ * ENUM_DEFINE_INDEXOF_MONOTONIC(ERROR, Error_IndexOf)
+ * ENUM_DEFINE_TOSTRING_BATCH(ERROR, Error_ToStringBatch, Error_IndexOf)
+ *
+ * char const* names[1024];
+ * size_t unknown = Error_ToStringBatch(codes, 1024, names);
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_TOSTRING_BATCH(e, fname, indexof) \
+    ENUM_BATCH_DEFINE_DENSE(e, fname) \
+    \
+    ENUM_DECLARE_TOSTRING_BATCH(e, fname) \
+    { \
+        ENUM_BATCH_BODY(e, fname, indexof, ENUM_BATCH_STORE_NAME) \
+    } \
+
+/**
+ * Emit a batch IndexOf function definition @p fname for the enum @p e.
+ *
+ * The function stores the index of each of the @p n values at @p in to the
+ * same position at @p out, or @ref ENUM_INDEX_UNKNOWN if the value is not an
+ * element.
+ *
+ * @param e       An enum name.
+ * @param fname   of batch IndexOf function.
+ * @param indexof An IndexOf function for @p e, used when no dense map is
+ *                built.
+ *
+ * @return The number of unknown values.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_DEFINE_INDEXOF_BATCH(ERROR, Error_IndexOfBatch, Error_IndexOf)
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_INDEXOF_BATCH(e, fname, indexof) \
+    ENUM_BATCH_DEFINE_DENSE(e, fname) \
+    \
+    ENUM_DECLARE_INDEXOF_BATCH(e, fname) \
+    { \
+        ENUM_BATCH_BODY(e, fname, indexof, ENUM_BATCH_STORE_INDEX) \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal store of index @p found for element @p i of an IndexOf batch.
+ */
+#define ENUM_BATCH_STORE_INDEX(e, out, i, found) \
+    ((out)[i] = (found))
+
+/**
+ * Internal store of index @p found for element @p i of a ToString batch.
+ */
+#define ENUM_BATCH_STORE_NAME(e, out, i, found) \
+    ((out)[i] = (found) == ENUM_INDEX_UNKNOWN ? NULL : e##_NameAt((size_t) (found)))
+
+/**
+ * Internal definitions of the dense value-to-index map of the batch
+ * function @p fname, and of the function which builds it.
+ *
+ * @p fname_RANGE is left 0, and the map unused, if the values span more
+ * than @ref ENUM_BATCH_DENSE_MAX integers.
+ */
+#define ENUM_BATCH_DEFINE_DENSE(e, fname) \
+    static int32_t fname##_DENSE[ENUM_BATCH_DENSE_MAX]; \
+    static size_t fname##_BASE; \
+    static size_t fname##_RANGE; \
+    static int fname##_DENSE_BUILT; \
+    \
+    ENUM_AT_LOAD static void fname##_DenseInit(void) \
+    { \
+        size_t count = sizeof(e##_IMPL)/sizeof(*e##_IMPL); \
+        enum e lo = e##_ValueAt(0); \
+        enum e hi = lo; \
+        size_t range = 0; \
+        size_t idx = 0; \
+        \
+        for (idx = 1; idx < count; ++idx) \
+        { \
+            enum e value = e##_ValueAt(idx); \
+            \
+            lo = value < lo ? value : lo; \
+            hi = value > hi ? value : hi; \
+        } \
+        \
+        range = (size_t) hi - (size_t) lo + 1; /* 0 if the range wraps */ \
+        if (range != 0 && range <= ENUM_BATCH_DENSE_MAX) \
+        { \
+            memset(fname##_DENSE, 0xff, range * sizeof(*fname##_DENSE)); \
+            for (idx = count; idx-- > 0; ) /* so the first of duplicates wins */ \
+            { \
+                fname##_DENSE[(size_t) e##_ValueAt(idx) - (size_t) lo] = (int32_t) idx; \
+            } \
+            \
+            fname##_BASE = (size_t) lo; \
+            fname##_RANGE = range; \
+        } \
+        \
+        fname##_DENSE_BUILT = 1; \
+    } \
+
+/**
+ * Internal body of the batch function @p fname, which finds the index of
+ * each value at @p in and passes it to @p store.
+ */
+#define ENUM_BATCH_BODY(e, fname, indexof, store) \
+        size_t unknown = 0; \
+        size_t idx = 0; \
+        \
+        if (!fname##_DENSE_BUILT) \
+        { \
+            fname##_DenseInit(); \
+        } \
+        \
+        if (fname##_RANGE != 0) \
+        { \
+            for (idx = 0; idx < n; ++idx) \
+            { \
+                size_t offset = (size_t) in[idx] - fname##_BASE; \
+                e##_Iterator_t found = offset < fname##_RANGE ? fname##_DENSE[offset] : ENUM_INDEX_UNKNOWN; \
+                \
+                unknown += (found == ENUM_INDEX_UNKNOWN); \
+                store(e, out, idx, found); \
+            } \
+        } \
+        else \
+        { \
+            e##_Iterator_t found = ENUM_INDEX_UNKNOWN; \
+            \
+            for (idx = 0; idx < n; ++idx) \
+            { \
+                if (idx == 0 || in[idx] != in[idx - 1]) \
+                { \
+                    found = indexof(in[idx]); \
+                } \
+                \
+                unknown += (found == ENUM_INDEX_UNKNOWN); \
+                store(e, out, idx, found); \
+            } \
+        } \
+        \
+        return unknown;
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_BATCH_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
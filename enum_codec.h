@@ -0,0 +1,567 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Streaming wire codec for sequences of enum values.
+ *
+ * A stream of values is written as the iterator indices of their elements,
+ * in blocks. Each block starts with a varint header,
+ * <tt>(count << 2) | mode</tt>, where mode is an @ref ENUM_CODEC_MODE:
+ *
+ * - @ref ENUM_CODEC_VARINT: @p count indices, each a little-endian base-128
+ *   varint;
+ * - @ref ENUM_CODEC_PACKED: @p count indices of @ref ENUM_PACKED_BITS bits
+ *   each, least significant bit first, padded to a whole byte;
+ * - @ref ENUM_CODEC_RUN: one varint index, repeated @p count times.
+ *
+ * The encoder collects runs of at least @ref ENUM_CODEC_MIN_RUN equal
+ * values into run blocks of any length, and other values into blocks of up
+ * to @ref ENUM_CODEC_BLOCK, each written in whichever of varint or packed
+ * form is shorter.
+ *
+ * Both ends work incrementally over caller buffers of any size, keeping
+ * their state in a caller-owned @ref Enum_Encoder or @ref Enum_Decoder, so
+ * neither allocates nor buffers more than one block. Decoded indices are
+ * checked against @p e_IMPL, so corrupt input is reported rather than
+ * turned into values which are not elements.
+ *
+ */
+#ifndef ENUM_CODEC_H
+#define ENUM_CODEC_H
+
+#include "enum.h"
+#include "enum_packed.h"
+
+/**
+ * The greatest number of values in a varint or packed block.
+ */
+#ifndef ENUM_CODEC_BLOCK
+#define ENUM_CODEC_BLOCK 64
+#endif
+
+/**
+ * The shortest run of equal values which the encoder writes as a run block.
+ */
+#ifndef ENUM_CODEC_MIN_RUN
+#define ENUM_CODEC_MIN_RUN 4
+#endif
+
+/**
+ * Block encodings, the low two bits of a block header.
+ */
+#define ENUM_CODEC_MODE(_, _V, _S, _VS) \
+    _VS(ENUM_CODEC_VARINT, 0, "Varint") \
+    _VS(ENUM_CODEC_PACKED, 1, "Packed") \
+    _VS(ENUM_CODEC_RUN, 2, "Run") \
+
+/**
+ * The C-Enum codec block mode enum.
+ */
+ENUM(ENUM_CODEC_MODE);
+
+/**
+ * The most bytes staged by an encoder: two blocks, each at most a ten byte
+ * header and four bytes per value.
+ */
+#define ENUM_CODEC_STAGED (2 * (10 + 4 * ENUM_CODEC_BLOCK))
+
+/**
+ * Encoder state. Initialise with @ref Enum_EncoderInit.
+ */
+struct Enum_Encoder
+{
+    uint32_t literals[ENUM_CODEC_BLOCK]; /**< Indices of the open block. */
+    size_t count;                        /**< Number of literals. */
+    uint32_t run;                        /**< Index of the trailing run. */
+    uint64_t run_length;                 /**< Length of the trailing run. */
+    uint8_t staged[ENUM_CODEC_STAGED];   /**< Encoded blocks not yet output. */
+    size_t staged_length;                /**< Bytes staged. */
+    size_t staged_at;                    /**< Bytes of those output. */
+};
+
+/**
+ * Decoder state. Initialise with @ref Enum_DecoderInit.
+ */
+struct Enum_Decoder
+{
+    uint64_t acc;       /**< Partial varint, or packed bits held. */
+    unsigned shift;     /**< Bits in @p acc. */
+    unsigned mode;      /**< @ref ENUM_CODEC_MODE of the open block. */
+    uint64_t remaining; /**< Values left in the open block, 0 if none. */
+    uint32_t run;       /**< Index of the open run block. */
+    int have_run;       /**< Non-zero once @p run is read. */
+};
+
+/**
+ * Makes @p self an encoder at the start of a stream.
+ */
+static inline void Enum_EncoderInit(struct Enum_Encoder* self)
+{
+    memset(self, 0, sizeof(*self));
+}
+
+/**
+ * Makes @p self a decoder at the start of a stream.
+ */
+static inline void Enum_DecoderInit(struct Enum_Decoder* self)
+{
+    memset(self, 0, sizeof(*self));
+}
+
+/**
+ * Emit codec function declarations for the enum @p e.
+ *
+ * @param e     C-Enum Name.
+ * @param codec Codec name, which prefixes the functions.
+ *
+ * @code
+ * ENUM_DECLARE_CODEC(STATE, StateCodec);
+ * @endcode
+ */
+#define ENUM_DECLARE_CODEC(e, codec) \
+    enum ENUM_STATUS codec##_Encode(struct Enum_Encoder* self, \
+                                    enum e const* in, size_t n, size_t* consumed, \
+                                    uint8_t* out, size_t size, size_t* written); \
+    size_t codec##_Flush(struct Enum_Encoder* self, uint8_t* out, size_t size, size_t* written); \
+    enum ENUM_STATUS codec##_Decode(struct Enum_Decoder* self, \
+                                    uint8_t const* in, size_t n, size_t* consumed, \
+                                    enum e* out, size_t size, size_t* written) \
+
+/**
+ * Emit codec function definitions for the enum @p e.
+ *
+ * - @p codec_Encode encodes values from the @p n at @p in, and writes
+ *   encoded bytes to the @p size at @p out, until either runs out. It
+ *   stores the number of values taken to @p consumed and of bytes written
+ *   to @p written, and returns @ref ENUM_OK, or @ref ENUM_E_UNKNOWN if
+ *   <tt>in[*consumed]</tt> is not an element.
+ * - @p codec_Flush ends the stream, writing the values held by the encoder
+ *   to @p out. It returns the number of bytes which did not fit: call it
+ *   again with more space until it returns 0.
+ * - @p codec_Decode decodes bytes from the @p n at @p in, and writes values
+ *   to the @p size at @p out, until either runs out. It stores the number
+ *   of bytes taken to @p consumed and of values written to @p written, and
+ *   returns @ref ENUM_OK, @ref ENUM_E_SYNTAX if a block header or varint is
+ *   malformed, or @ref ENUM_E_UNKNOWN if an index is not that of an
+ *   element. After an error, the decoder must be initialised again.
+ *
+ * Values are held by the encoder until they complete a block, so a stream
+ * only decodes in full once it is flushed.
+ *
+ * @param e       An enum name.
+ * @param codec   Codec name, as passed to @ref ENUM_DECLARE_CODEC.
+ * @param indexof An IndexOf function for @p e, such as one from
+ *                @ref ENUM_DEFINE_INDEXOF.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ *
+ * @note No closing semi-colon.
+ * @note Elements which share a value with an earlier element decode to it.
+ *
+ * @code
+ * ENUM_IMPL(STATE);
+ * ENUM_DEFINE_INDEXOF(STATE, State_IndexOf)
+ * ENUM_DEFINE_CODEC(STATE, StateCodec, State_IndexOf)
+ *
+ * struct Enum_Encoder enc;
+ * uint8_t buf[4096];
+ * size_t consumed, written;
+ *
+ * Enum_EncoderInit(&enc);
+ * while (n > 0)
+ * {
+ *     if (StateCodec_Encode(&enc, states, n, &consumed, buf, sizeof(buf), &written) != ENUM_OK)
+ *     {
+ *         break;
+ *     }
+ *     send(fd, buf, written, 0);
+ *     states += consumed;
+ *     n -= consumed;
+ * }
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_CODEC(e, codec, indexof) \
+    enum ENUM_STATUS codec##_Encode(struct Enum_Encoder* self, \
+                                    enum e const* in, size_t n, size_t* consumed, \
+                                    uint8_t* out, size_t size, size_t* written) \
+    { \
+        e##_Iterator_t idx = ENUM_INDEX_UNKNOWN; \
+        enum ENUM_STATUS status = ENUM_OK; \
+        size_t done = 0; \
+        size_t at = Enum_EncoderDrain(self, out, size); \
+        \
+        /* only add to an empty stage, which then has room for the blocks one value can end */ \
+        for (done = 0; done < n && self->staged_length == 0; ++done) \
+        { \
+            if (done == 0 || in[done] != in[done - 1]) \
+            { \
+                idx = indexof(in[done]); \
+            } \
+            \
+            if (idx == ENUM_INDEX_UNKNOWN) \
+            { \
+                status = ENUM_E_UNKNOWN; \
+                break; \
+            } \
+            \
+            Enum_EncoderAdd(self, (uint32_t) idx, ENUM_PACKED_BITS(e)); \
+            at += Enum_EncoderDrain(self, out + at, size - at); \
+        } \
+        \
+        *(consumed) = done; \
+        *(written) = at; \
+        return status; \
+    } \
+    \
+    size_t codec##_Flush(struct Enum_Encoder* self, uint8_t* out, size_t size, size_t* written) \
+    { \
+        size_t at = Enum_EncoderDrain(self, out, size); \
+        \
+        if (self->staged_length == 0) \
+        { \
+            Enum_EncoderEndRun(self, ENUM_PACKED_BITS(e)); \
+            Enum_EncoderEndBlock(self, ENUM_PACKED_BITS(e)); \
+            at += Enum_EncoderDrain(self, out + at, size - at); \
+        } \
+        \
+        *(written) = at; \
+        return self->staged_length - self->staged_at; \
+    } \
+    \
+    enum ENUM_STATUS codec##_Decode(struct Enum_Decoder* self, \
+                                    uint8_t const* in, size_t n, size_t* consumed, \
+                                    enum e* out, size_t size, size_t* written) \
+    { \
+        enum ENUM_STATUS status = ENUM_OK; \
+        size_t at = 0; \
+        size_t done = 0; \
+        uint64_t idx = 0; \
+        \
+        while (done < size) \
+        { \
+            int got = Enum_DecoderNext(self, in, n, &at, ENUM_PACKED_BITS(e), &idx); \
+            \
+            if (got <= 0) \
+            { \
+                status = got < 0 ? ENUM_E_SYNTAX : ENUM_OK; \
+                break; \
+            } \
+            \
+            if (idx >= sizeof(e##_IMPL)/sizeof(*e##_IMPL)) \
+            { \
+                status = ENUM_E_UNKNOWN; \
+                break; \
+            } \
+            \
+            out[done++] = e##_ValueAt((size_t) idx); \
+        } \
+        \
+        *(consumed) = at; \
+        *(written) = done; \
+        return status; \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal number of bytes in the varint of @p value.
+ */
+static inline size_t Enum_VarintSize(uint64_t value)
+{
+    size_t size = 1;
+
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        size++;
+    }
+
+    return size;
+}
+
+/**
+ * Internal write of the varint of @p value to @p out.
+ *
+ * @return The number of bytes written.
+ */
+static inline size_t Enum_VarintPut(uint8_t* out, uint64_t value)
+{
+    size_t at = 0;
+
+    while (value >= 0x80)
+    {
+        out[at++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+
+    out[at++] = (uint8_t) value;
+    return at;
+}
+
+/**
+ * Internal copy of staged bytes of @p self to the @p size at @p out.
+ *
+ * @return The number of bytes copied. The stage is emptied once all are.
+ */
+static inline size_t Enum_EncoderDrain(struct Enum_Encoder* self, uint8_t* out, size_t size)
+{
+    size_t left = self->staged_length - self->staged_at;
+    size_t len = left < size ? left : size;
+
+    if (len > 0)
+    {
+        memcpy(out, self->staged + self->staged_at, len);
+        self->staged_at += len;
+    }
+
+    if (self->staged_at == self->staged_length)
+    {
+        self->staged_length = 0;
+        self->staged_at = 0;
+    }
+
+    return len;
+}
+
+/**
+ * Internal stage of the literals of @p self as a varint or packed block of
+ * @p bits per index, whichever is shorter.
+ */
+static inline void Enum_EncoderEndBlock(struct Enum_Encoder* self, unsigned bits)
+{
+    uint8_t* out = self->staged + self->staged_length;
+    size_t varint_size = 0;
+    size_t idx = 0;
+
+    if (self->count == 0)
+    {
+        return;
+    }
+
+    for (idx = 0; idx < self->count; ++idx)
+    {
+        varint_size += Enum_VarintSize(self->literals[idx]);
+    }
+
+    if ((self->count * bits + 7) / 8 <= varint_size)
+    {
+        uint64_t acc = 0;
+        unsigned held = 0;
+
+        out += Enum_VarintPut(out, (uint64_t) self->count << 2 | ENUM_CODEC_PACKED);
+        for (idx = 0; idx < self->count; ++idx)
+        {
+            acc |= (uint64_t) self->literals[idx] << held;
+            for (held += bits; held >= 8; held -= 8)
+            {
+                *out++ = (uint8_t) acc;
+                acc >>= 8;
+            }
+        }
+
+        if (held > 0)
+        {
+            *out++ = (uint8_t) acc;
+        }
+    }
+    else
+    {
+        out += Enum_VarintPut(out, (uint64_t) self->count << 2 | ENUM_CODEC_VARINT);
+        for (idx = 0; idx < self->count; ++idx)
+        {
+            out += Enum_VarintPut(out, self->literals[idx]);
+        }
+    }
+
+    self->staged_length = (size_t) (out - self->staged);
+    self->count = 0;
+}
+
+/**
+ * Internal end of the trailing run of @p self: staged as a run block if it
+ * is long enough, else added to the literals.
+ */
+static inline void Enum_EncoderEndRun(struct Enum_Encoder* self, unsigned bits)
+{
+    if (self->run_length >= ENUM_CODEC_MIN_RUN)
+    {
+        uint8_t* out = self->staged;
+
+        Enum_EncoderEndBlock(self, bits);
+        out += self->staged_length;
+        out += Enum_VarintPut(out, self->run_length << 2 | ENUM_CODEC_RUN);
+        out += Enum_VarintPut(out, self->run);
+        self->staged_length = (size_t) (out - self->staged);
+    }
+    else
+    {
+        for (; self->run_length > 0; --self->run_length)
+        {
+            self->literals[self->count++] = self->run;
+            if (self->count == ENUM_CODEC_BLOCK)
+            {
+                Enum_EncoderEndBlock(self, bits);
+            }
+        }
+    }
+
+    self->run_length = 0;
+}
+
+/**
+ * Internal addition of the index @p idx to the stream of @p self.
+ */
+static inline void Enum_EncoderAdd(struct Enum_Encoder* self, uint32_t idx, unsigned bits)
+{
+    if (self->run_length > 0 && self->run == idx)
+    {
+        self->run_length++;
+        return;
+    }
+
+    Enum_EncoderEndRun(self, bits);
+    self->run = idx;
+    self->run_length = 1;
+}
+
+/**
+ * Internal read of a varint from the @p n bytes at @p in, from @p *at,
+ * into the accumulator of @p self.
+ *
+ * @return 1 once the varint is complete, 0 if more input is needed, or -1
+ *         if it overflows 64 bits.
+ */
+static inline int Enum_DecoderVarint(struct Enum_Decoder* self, uint8_t const* in, size_t n, size_t* at)
+{
+    while (*at < n)
+    {
+        uint8_t byte = in[(*at)++];
+
+        if (self->shift == 63 && byte > 1)
+        {
+            return -1;
+        }
+
+        self->acc |= (uint64_t) (byte & 0x7f) << self->shift;
+        self->shift += 7;
+
+        if (!(byte & 0x80))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Internal decode of the next index of @p bits bits from the @p n bytes at
+ * @p in, from @p *at, into @p *idx.
+ *
+ * @return 1 if an index was decoded, 0 if more input is needed, or -1 if
+ *         the input is malformed.
+ */
+static inline int Enum_DecoderNext(struct Enum_Decoder* self,
+                                   uint8_t const* in,
+                                   size_t n,
+                                   size_t* at,
+                                   unsigned bits,
+                                   uint64_t* idx)
+{
+    int got = 0;
+
+    if (self->remaining == 0)
+    {
+        got = Enum_DecoderVarint(self, in, n, at);
+        if (got <= 0)
+        {
+            return got;
+        }
+
+        self->mode = (unsigned) (self->acc & 3);
+        self->remaining = self->acc >> 2;
+        self->acc = 0;
+        self->shift = 0;
+
+        if (self->remaining == 0 || self->mode > ENUM_CODEC_RUN)
+        {
+            return -1;
+        }
+    }
+
+    if (self->mode == ENUM_CODEC_PACKED)
+    {
+        while (self->shift < bits)
+        {
+            if (*at == n)
+            {
+                return 0;
+            }
+
+            self->acc |= (uint64_t) in[(*at)++] << self->shift;
+            self->shift += 8;
+        }
+
+        *idx = self->acc & (((uint64_t) 1 << bits) - 1);
+        self->acc >>= bits;
+        self->shift -= bits;
+
+        if (--self->remaining == 0)
+        {
+            /* drop the padding */
+            self->acc = 0;
+            self->shift = 0;
+        }
+
+        return 1;
+    }
+
+    if (self->mode == ENUM_CODEC_RUN && self->have_run)
+    {
+        *idx = self->run;
+        self->have_run = --self->remaining > 0;
+        return 1;
+    }
+
+    got = Enum_DecoderVarint(self, in, n, at);
+    if (got <= 0)
+    {
+        return got;
+    }
+
+    *idx = self->acc;
+    self->acc = 0;
+    self->shift = 0;
+
+    if (self->mode == ENUM_CODEC_RUN)
+    {
+        /* an index too wide for the run is out of range anyway */
+        self->run = *idx > UINT32_MAX ? UINT32_MAX : (uint32_t) *idx;
+        self->have_run = --self->remaining > 0;
+        return 1;
+    }
+
+    self->remaining--;
+    return 1;
+}
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_CODEC_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
@@ -0,0 +1,113 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Constant-time ToString for contiguous enums.
+ *
+ * An enum is contiguous when its elements, in declaration order, take the
+ * values <tt>[base, base + N)</tt>:
+ *
+ * <tt>For all x, [x]+1 = [x+1]</tt>
+ *
+ * For such an enum the @p e_IMPL table emitted by @ref ENUM_IMPL is already
+ * indexed by <tt>value - base</tt>, so a name can be found with a single
+ * bounds check instead of a linear scan.
+ *
+ */
+#ifndef ENUM_CONTIGUOUS_H
+#define ENUM_CONTIGUOUS_H
+
+#include "enum.h"
+
+/**
+ * Integer constant expression which is non-zero if the enum @p e is
+ * contiguous.
+ *
+ * @param e A C-Enum list.
+ *
+ * @note Not usable in @p \#if, since it refers to enum constants.
+ *
+ * @code
+ * typedef char colour_is_contiguous[ENUM_IS_CONTIGUOUS(COLOUR) ? 1 : -1];
+ * @endcode
+ */
+#define ENUM_IS_CONTIGUOUS(e) \
+    (((ENUM_FIRST_VALUE(e)) == \
+        e(ENUM_CONTIGUOUS_LINK, ENUM_CONTIGUOUS_LINK, ENUM_CONTIGUOUS_LINK, ENUM_CONTIGUOUS_LINK) \
+    (ENUM_LAST_VALUE(e)) + 1LL))
+
+/**
+ * Emit a constant-time ToString function definition @p fname for the
+ * contiguous enum @p e.
+ *
+ * Returns the same strings as @ref ENUM_DEFINE_TOSTRING, including
+ * @ref ENUM_UNKNOWN_STRING for values outside <tt>[base, base + N)</tt>.
+ *
+ * @param e An enum name.
+ * @param fname of ToString function.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ * @pre @p e must be contiguous, which is checked at compile time.
+ *
+ * @note No closing semi-colon.
+ * @note Declare with @ref ENUM_DECLARE_TOSTRING.
+ *
+ * @code
+ * #define COLOUR(_, _V, _S, _VS) \
+ *     _(RED) \
+ *     _(GREEN) \
+ *     _(BLUE) \
+ *
+ * ENUM(COLOUR);
+ * ENUM_IMPL(COLOUR);
+ * ENUM_DEFINE_TOSTRING_CONTIGUOUS(COLOUR, Colour_ToString)
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_TOSTRING_CONTIGUOUS(e, fname) \
+    ENUM_DECLARE_TOSTRING(e, fname) \
+    { \
+        /* negative offsets wrap to large values, so one test covers both bounds */ \
+        size_t idx = (size_t) (literal) - (size_t) e##_ValueAt(0); \
+        \
+        ENUM_STATIC_ASSERT(ENUM_IS_CONTIGUOUS(e)); \
+        \
+        if (idx >= sizeof(e##_IMPL)/sizeof(*e##_IMPL)) \
+        { \
+            return ENUM_UNKNOWN_STRING; \
+        } \
+        \
+        return e##_NameAt(idx); \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal X-Macro link which emits <tt>(name)) && ((name) + 1LL ==</tt>.
+ *
+ * Chains adjacent elements into <tt>((a) + 1LL == (b))</tt> terms.
+ *
+ * @see ENUM_IS_CONTIGUOUS
+ */
+#define ENUM_CONTIGUOUS_LINK(...) \
+    (ENUM_NAME_OF(__VA_ARGS__))) && ((ENUM_NAME_OF(__VA_ARGS__)) + 1LL ==
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_CONTIGUOUS_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
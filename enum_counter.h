@@ -0,0 +1,239 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Sharded per-element counters for high-rate telemetry.
+ *
+ * A counter holds one 64-bit count per element of the enum in each of a
+ * fixed number of shards. A shard is a dense array indexed by an IndexOf
+ * function, padded to whole cache lines and, under GCC compatible
+ * compilers, aligned to one, so no two shards share a line.
+ *
+ * Each writing thread, or CPU, owns a shard, so an increment is a relaxed
+ * atomic load, add and store to a line no other writer touches: no locks,
+ * no read-modify-write instructions and no false sharing. Totals are summed
+ * over the shards, with relaxed atomic loads, when read.
+ *
+ * Elements which share a value with an earlier element share its count.
+ *
+ */
+#ifndef ENUM_COUNTER_H
+#define ENUM_COUNTER_H
+
+#include "enum.h"
+
+/**
+ * Size, in bytes, of a cache line, to which counter shards are padded.
+ */
+#ifndef ENUM_CACHE_LINE
+#define ENUM_CACHE_LINE 64
+#endif
+
+/**
+ * Integer constant expression for the number of counts in one shard of a
+ * counter of the enum @p e: its element count rounded up to whole cache
+ * lines.
+ *
+ * @param e A C-Enum list.
+ */
+#define ENUM_COUNTER_STRIDE(e) \
+    ((ENUM_COUNT(e) + ENUM_CACHE_LINE / 8 - 1) / (ENUM_CACHE_LINE / 8) * (ENUM_CACHE_LINE / 8))
+
+/**
+ * Emit the counter type @p counter_t and its function declarations for the
+ * enum @p e.
+ *
+ * @param e       C-Enum Name.
+ * @param counter Counter name, which prefixes the type and functions.
+ * @param shards  Number of shards, usually the number of writing threads.
+ *
+ * @note Needs only @ref ENUM, so may be used in headers.
+ * @note Shards are only cache line aligned where the counter is: define
+ *       counters statically, or allocate them with @p aligned_alloc or
+ *       @p posix_memalign.
+ *
+ * @code
+ * ENUM_DECLARE_COUNTER(ERROR, ErrorCounter, 64);
+ *
+ * static ErrorCounter_t errors;
+ * @endcode
+ */
+#define ENUM_DECLARE_COUNTER(e, counter, shards) \
+    typedef struct \
+    { \
+        struct ENUM_CACHE_ALIGNED \
+        { \
+            uint64_t counts[ENUM_COUNTER_STRIDE(e)]; \
+        } shard[shards]; \
+    } counter##_t; \
+    \
+    enum ENUM_STATUS counter##_Add(counter##_t* self, size_t shard, enum e literal, uint64_t n); \
+    enum ENUM_STATUS counter##_Increment(counter##_t* self, size_t shard, enum e literal); \
+    uint64_t counter##_Get(counter##_t const* self, enum e literal); \
+    void counter##_Aggregate(counter##_t const* self, uint64_t* totals) \
+
+/**
+ * Emit the function definitions of the counter @p counter for the enum
+ * @p e.
+ *
+ * - @p counter_Add adds @p n to the count of @p literal in @p shard.
+ * - @p counter_Increment adds one.
+ * - @p counter_Get returns the count of @p literal summed over the shards,
+ *   or zero if @p literal is not an element.
+ * - @p counter_Aggregate walks the elements from @p begin to @p end and
+ *   stores the count of each, summed over the shards, to
+ *   <tt>totals[iter]</tt>. @p totals holds @ref ENUM_COUNT elements. An
+ *   element which shares a value with an earlier one gets that one's count.
+ *
+ * @p counter_Add and @p counter_Increment return @ref ENUM_OK, or
+ * @ref ENUM_E_UNKNOWN if @p literal is not an element.
+ *
+ * @param e       An enum name.
+ * @param counter Counter name, as passed to @ref ENUM_DECLARE_COUNTER.
+ * @param indexof An IndexOf function for @p e, such as one from
+ *                @ref ENUM_DEFINE_INDEXOF.
+ * @param begin   Iterator Begin function of @p e.
+ * @param end     Iterator End function of @p e.
+ *
+ * @pre @ref ENUM_DECLARE_COUNTER for @p counter must be visible in the
+ *      current context.
+ * @pre A shard is written by one thread at a time, and @p shard is less
+ *      than the shard count.
+ *
+ * @note No closing semi-colon.
+ * @note Counts are read without ordering against other memory. While
+ *       writers run, a total is a recent, not an exact, figure; once they
+ *       have been joined, it is exact.
+ *
+ * @code
+ * ENUM_IMPL(ERROR);
+ * ENUM_DEFINE_INDEXOF(ERROR, Error_IndexOf)
+ * ENUM_DEFINE_ITERATOR(ERROR, Error_IteratorBegin, Error_IteratorEnd, Error_IteratorToValue)
+ * ENUM_DEFINE_COUNTER(ERROR, ErrorCounter, Error_IndexOf, Error_IteratorBegin, Error_IteratorEnd)
+ *
+ * // worker thread
+ * ErrorCounter_Increment(&errors, worker_id, ERROR_TIMEOUT);
+ *
+ * // reporting thread
+ * uint64_t totals[ENUM_COUNT(ERROR)];
+ *
+ * ErrorCounter_Aggregate(&errors, totals);
+ * for (iter = Error_IteratorBegin(); iter <= Error_IteratorEnd(); iter++)
+ * {
+ *     printf("%s: %llu\n", Error_ToString(Error_IteratorToValue(iter)),
+ *            (unsigned long long) totals[iter]);
+ * }
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_COUNTER(e, counter, indexof, begin, end) \
+    enum ENUM_STATUS counter##_Add(counter##_t* self, size_t shard, enum e literal, uint64_t n) \
+    { \
+        e##_Iterator_t idx = indexof(literal); \
+        \
+        if (idx == ENUM_INDEX_UNKNOWN) \
+        { \
+            return ENUM_E_UNKNOWN; \
+        } \
+        \
+        ENUM_COUNTER_STORE(&self->shard[shard].counts[idx], \
+                           ENUM_COUNTER_LOAD(&self->shard[shard].counts[idx]) + n); \
+        return ENUM_OK; \
+    } \
+    \
+    enum ENUM_STATUS counter##_Increment(counter##_t* self, size_t shard, enum e literal) \
+    { \
+        return counter##_Add(self, shard, literal, 1); \
+    } \
+    \
+    uint64_t counter##_Get(counter##_t const* self, enum e literal) \
+    { \
+        e##_Iterator_t idx = indexof(literal); \
+        uint64_t total = 0; \
+        size_t shard = 0; \
+        \
+        for (shard = 0; idx != ENUM_INDEX_UNKNOWN \
+                        && shard < sizeof(self->shard)/sizeof(*self->shard); ++shard) \
+        { \
+            total += ENUM_COUNTER_LOAD(&self->shard[shard].counts[idx]); \
+        } \
+        \
+        return total; \
+    } \
+    \
+    void counter##_Aggregate(counter##_t const* self, uint64_t* totals) \
+    { \
+        e##_Iterator_t iter; \
+        size_t shard = 0; \
+        \
+        ENUM_STATIC_ASSERT(ENUM_COUNT(e) == sizeof(e##_IMPL)/sizeof(*e##_IMPL)); \
+        \
+        for (iter = begin(); iter <= end(); ++iter) \
+        { \
+            totals[iter] = 0; \
+        } \
+        \
+        /* shard by shard, so each shard's lines are read once, in order */ \
+        for (shard = 0; shard < sizeof(self->shard)/sizeof(*self->shard); ++shard) \
+        { \
+            for (iter = begin(); iter <= end(); ++iter) \
+            { \
+                totals[iter] += ENUM_COUNTER_LOAD(&self->shard[shard].counts[iter]); \
+            } \
+        } \
+        \
+        /* an alias is only ever counted at its first element, which precedes it */ \
+        for (iter = begin(); iter <= end(); ++iter) \
+        { \
+            e##_Iterator_t first = indexof(e##_ValueAt((size_t) iter)); \
+            \
+            if (first != iter) \
+            { \
+                totals[iter] = totals[first]; \
+            } \
+        } \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal attribute which aligns a type to @ref ENUM_CACHE_LINE, where the
+ * compiler supports it.
+ */
+#if defined(__GNUC__)
+#define ENUM_CACHE_ALIGNED __attribute__((aligned(ENUM_CACHE_LINE)))
+#else
+#define ENUM_CACHE_ALIGNED
+#endif
+
+/**
+ * Internal relaxed atomic load and store of a count, which keep concurrent
+ * reads of a shard well defined, where the compiler supports them.
+ */
+#if defined(__GNUC__)
+#define ENUM_COUNTER_LOAD(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#define ENUM_COUNTER_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#else
+#define ENUM_COUNTER_LOAD(p) (*(p))
+#define ENUM_COUNTER_STORE(p, v) (*(p) = (v))
+#endif
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_COUNTER_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
@@ -0,0 +1,355 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Formatting and parsing of bitmask enums.
+ *
+ * A flags enum gives each element a single bit, as in:
+ *
+ * @code
+ * #define PERM(_, _V, _S, _VS) \
+ *     _V(PERM_READ, (1u << 0)) \
+ *     _V(PERM_WRITE, (1u << 1)) \
+ *     _V(PERM_EXEC, (1u << 2)) \
+ *     _V(PERM_RW, PERM_READ | PERM_WRITE) \
+ * @endcode
+ *
+ * @ref ENUM_DEFINE_TOSTRING only names single elements, so a combined mask
+ * such as <tt>PERM_READ | PERM_EXEC</tt> is unknown to it. The functions here
+ * format any mask as <tt>PERM_READ|PERM_EXEC</tt>, and parse the same syntax
+ * back.
+ *
+ * - Each set bit is named through a 64-entry bit-to-index table, found with a
+ *   count-trailing-zeros, so formatting costs O(set bits), not O(elements).
+ * - Formatting writes to a caller buffer and never allocates.
+ * - Set bits which no single-bit element names are formatted as one
+ *   hexadecimal term, such as <tt>PERM_READ|0x10</tt>, and a zero mask as
+ *   <tt>0</tt>, so any mask round-trips.
+ * - Multi-bit elements, such as @p PERM_RW, are accepted by the parser but
+ *   never produced by the formatter.
+ *
+ * Masks are carried as @p uint64_t. Names must not contain @p '|'.
+ *
+ */
+#ifndef ENUM_FLAGS_H
+#define ENUM_FLAGS_H
+
+#include "enum.h"
+
+/**
+ * Emit a bit name function declaration @p fname for the flags enum @p e.
+ *
+ * @param e     C-Enum Name.
+ * @param fname Bit name function name.
+ */
+#define ENUM_DECLARE_FLAGS_BITNAME(e, fname) \
+    char const* fname(unsigned bit)
+
+/**
+ * Emit a flags ToString function declaration @p fname for the enum @p e.
+ *
+ * @param e     C-Enum Name.
+ * @param fname Flags ToString function name.
+ */
+#define ENUM_DECLARE_FLAGS_TOSTRING(e, fname) \
+    size_t fname(uint64_t mask, char* buf, size_t size)
+
+/**
+ * Emit a flags FromString function declaration @p fname for the enum @p e.
+ *
+ * @param e     C-Enum Name.
+ * @param fname Flags FromString function name.
+ */
+#define ENUM_DECLARE_FLAGS_FROMSTRING(e, fname) \
+    enum ENUM_STATUS fname(char const* str, size_t len, uint64_t* mask)
+
+/**
+ * Emit a bit name function definition @p fname for the flags enum @p e.
+ *
+ * The function returns the name of the first element whose value is
+ * <tt>1 << bit</tt>, or @p NULL if there is none, in O(1).
+ *
+ * The bit-to-index table is built on load under GCC compatible compilers,
+ * otherwise on the first call, as for @ref ENUM_DEFINE_FROMSTRING.
+ *
+ * @param e An enum name.
+ * @param fname of bit name function.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_DEFINE_FLAGS_BITNAME(PERM, Perm_BitName)
+ *
+ * char const* name = Perm_BitName(2); // "PERM_EXEC"
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_FLAGS_BITNAME(e, fname) \
+    static size_t fname##_BITS[64]; \
+    static int fname##_BITS_BUILT; \
+    \
+    ENUM_AT_LOAD static void fname##_BitsInit(void) \
+    { \
+        size_t idx = 0; \
+        \
+        for (idx = 0; idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL); ++idx) \
+        { \
+            uint64_t value = (uint64_t) e##_ValueAt(idx); \
+            \
+            if (value != 0 && (value & (value - 1)) == 0 \
+                && fname##_BITS[Enum_Ctz64(value)] == 0) \
+            { \
+                fname##_BITS[Enum_Ctz64(value)] = idx + 1; \
+            } \
+        } \
+        \
+        fname##_BITS_BUILT = 1; \
+    } \
+    \
+    ENUM_DECLARE_FLAGS_BITNAME(e, fname) \
+    { \
+        if (!fname##_BITS_BUILT) \
+        { \
+            fname##_BitsInit(); \
+        } \
+        \
+        if (bit >= 64 || fname##_BITS[bit] == 0) \
+        { \
+            return NULL; \
+        } \
+        \
+        return e##_NameAt(fname##_BITS[bit] - 1); \
+    } \
+
+/**
+ * Emit a flags ToString function definition @p fname for the enum @p e.
+ *
+ * The function formats @p mask as the names of its set bits joined by
+ * @p '|', in ascending bit order, into @p buf. As with @p snprintf, at most
+ * @p size - 1 characters are written, the output is NUL terminated if
+ * @p size is non-zero, and the return value is the length of the whole
+ * string, so a return value not less than @p size means it was truncated.
+ *
+ * @param e An enum name.
+ * @param fname of flags ToString function.
+ * @param bitname A bit name function for @p e, from
+ *                @ref ENUM_DEFINE_FLAGS_BITNAME.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_DEFINE_FLAGS_BITNAME(PERM, Perm_BitName)
+ * ENUM_DEFINE_FLAGS_TOSTRING(PERM, Perm_ToString, Perm_BitName)
+ *
+ * char buf[64];
+ * size_t len = Perm_ToString(PERM_READ | PERM_EXEC, buf, sizeof(buf));
+ * // buf = "PERM_READ|PERM_EXEC", len = 19
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_FLAGS_TOSTRING(e, fname, bitname) \
+    ENUM_DECLARE_FLAGS_TOSTRING(e, fname) \
+    { \
+        uint64_t rest = mask; \
+        uint64_t unnamed = 0; \
+        size_t length = 0; \
+        \
+        while (rest != 0) \
+        { \
+            unsigned bit = Enum_Ctz64(rest); \
+            char const* name = bitname(bit); \
+            \
+            rest &= rest - 1; \
+            if (name == NULL) \
+            { \
+                unnamed |= (uint64_t) 1 << bit; \
+                continue; \
+            } \
+            \
+            length += Enum_Append(buf, size, length, "|", length != 0); \
+            length += Enum_Append(buf, size, length, name, strlen(name)); \
+        } \
+        \
+        if (unnamed != 0 || mask == 0) \
+        { \
+            length += Enum_Append(buf, size, length, "|", length != 0); \
+            length += Enum_FlagsAppendHex(buf, size, length, unnamed); \
+        } \
+        \
+        if (size != 0) \
+        { \
+            buf[length < size ? length : size - 1] = '\0'; \
+        } \
+        \
+        return length; \
+    } \
+
+/**
+ * Emit a flags FromString function definition @p fname for the enum @p e.
+ *
+ * The function parses the @p len characters at @p str as terms joined by
+ * @p '|', with no spaces, and stores the union of their values to @p mask.
+ * Each term is an element name, or a hexadecimal number in the form
+ * <tt>0x10</tt>, or @p 0.
+ *
+ * @param e An enum name.
+ * @param fname of flags FromString function.
+ * @param fromstring A FromString function for @p e, from
+ *                   @ref ENUM_DEFINE_FROMSTRING.
+ *
+ * @return @ref ENUM_OK, @ref ENUM_E_UNKNOWN if a term names no element, or
+ *         @ref ENUM_E_SYNTAX if a term is empty. @p mask is only written on
+ *         success.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_DEFINE_FROMSTRING(PERM, Perm_FromName)
+ * ENUM_DEFINE_FLAGS_FROMSTRING(PERM, Perm_FromString, Perm_FromName)
+ *
+ * uint64_t mask;
+ * enum ENUM_STATUS status = Perm_FromString("PERM_RW|PERM_EXEC", 17, &mask);
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_FLAGS_FROMSTRING(e, fname, fromstring) \
+    ENUM_DECLARE_FLAGS_FROMSTRING(e, fname) \
+    { \
+        uint64_t result = 0; \
+        size_t start = 0; \
+        \
+        for (;;) \
+        { \
+            size_t end = start; \
+            uint64_t bits = 0; \
+            \
+            while (end < len && str[end] != '|') \
+            { \
+                ++end; \
+            } \
+            \
+            if (end == start) \
+            { \
+                return ENUM_E_SYNTAX; \
+            } \
+            \
+            if (!Enum_FlagsParseHex(str + start, end - start, &bits)) \
+            { \
+                enum e literal; \
+                \
+                if (fromstring(str + start, end - start, &literal) != ENUM_OK) \
+                { \
+                    return ENUM_E_UNKNOWN; \
+                } \
+                \
+                bits = (uint64_t) literal; \
+            } \
+            \
+            result |= bits; \
+            if (end == len) \
+            { \
+                break; \
+            } \
+            \
+            start = end + 1; \
+        } \
+        \
+        *(mask) = result; \
+        return ENUM_OK; \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal append of @p bits in hexadecimal, as <tt>0x1f</tt>, or @p 0.
+ *
+ * @return As for @ref Enum_Append.
+ */
+static inline size_t Enum_FlagsAppendHex(char* buf, size_t size, size_t at, uint64_t bits)
+{
+    char hex[2 + 16];
+    size_t len = sizeof(hex);
+
+    if (bits == 0)
+    {
+        return Enum_Append(buf, size, at, "0", 1);
+    }
+
+    while (bits != 0)
+    {
+        hex[--len] = "0123456789abcdef"[bits & 0xf];
+        bits >>= 4;
+    }
+
+    hex[--len] = 'x';
+    hex[--len] = '0';
+
+    return Enum_Append(buf, size, at, hex + len, sizeof(hex) - len);
+}
+
+/**
+ * Internal parse of the @p len characters at @p str as @p 0, or as
+ * <tt>0x</tt> followed by one to sixteen hexadecimal digits.
+ *
+ * @return Non-zero, with the number stored to @p bits, if the term is a
+ *         number.
+ */
+static inline int Enum_FlagsParseHex(char const* str, size_t len, uint64_t* bits)
+{
+    uint64_t result = 0;
+    size_t idx;
+
+    if (len == 1 && str[0] == '0')
+    {
+        *bits = 0;
+        return 1;
+    }
+
+    if (len < 3 || len > 2 + 16 || str[0] != '0' || (str[1] != 'x' && str[1] != 'X'))
+    {
+        return 0;
+    }
+
+    for (idx = 2; idx < len; ++idx)
+    {
+        char c = str[idx];
+
+        if (c >= '0' && c <= '9')
+        {
+            result = result << 4 | (uint64_t) (c - '0');
+        }
+        else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+        {
+            result = result << 4 | (uint64_t) ((c | 0x20) - 'a' + 10);
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    *bits = result;
+    return 1;
+}
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_FLAGS_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
@@ -0,0 +1,331 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Hot/cold table layout: values and symbolic names apart from
+ *        descriptions.
+ *
+ * @ref ENUM_IMPL stores an element's descriptive string, such as
+ * "Sides of a Triangle", in place of its name, next to its value, so value
+ * lookups pull description text into cache alongside the values they scan.
+ *
+ * @ref ENUM_IMPL_HOT_COLD splits the table in two:
+ *
+ * - the hot part, @p e_IMPL, an array of values, and @p e_NAMES, a pool of
+ *   the short symbolic names, as @p #name, with their offsets and lengths;
+ * - the cold part, @p e_DESCRIPTIONS, a pool of the descriptive strings
+ *   with their offsets, placed in the linker section
+ *   @ref ENUM_COLD_SECTION where the toolchain supports it.
+ *
+ * Both pools hold their characters in place, as @ref ENUM_IMPL_POOL does,
+ * so the description text itself, not just pointers to it, lands in the
+ * cold section.
+ *
+ * @p e_NameAt returns the symbolic name, so ToString, FromString and the
+ * other ENUM_DEFINE_* functions read only the hot part. Descriptions are
+ * read by @p e_DescriptionAt, or by a function from
+ * @ref ENUM_DEFINE_DESCRIPTION.
+ *
+ */
+#ifndef ENUM_HOTCOLD_H
+#define ENUM_HOTCOLD_H
+
+#include "enum.h"
+
+/**
+ * Name of the linker section which holds cold tables. Define
+ * @p ENUM_NO_COLD_SECTION to leave them in the default section.
+ */
+#ifndef ENUM_COLD_SECTION
+#define ENUM_COLD_SECTION ".enum_cold"
+#endif
+
+/**
+ * Allocates a hot/cold split data table for the enum @p e.
+ *
+ * A drop-in alternative to @ref ENUM_IMPL. It emits @p e_IMPL, a static
+ * constant array of values, @p e_NAMES, a pool of symbolic names,
+ * @p e_DESCRIPTIONS, a pool of descriptive strings, and the accessors
+ * @p e_ValueAt, @p e_NameAt and @p e_NameLengthAt over the hot part and
+ * @p e_DescriptionAt and @p e_DescriptionLengthAt over the cold part.
+ *
+ * An element without a descriptive string has no cold entry, and its
+ * description is its symbolic name, as @ref ENUM_IMPL would print it.
+ *
+ * @param e A C-Enum list. Descriptive strings must be string literals.
+ *
+ * @note This is a required pre-declaration for all ENUM_DEFINE_* macros, in
+ *       place of @ref ENUM_IMPL.
+ * @note Unlike @ref ENUM_IMPL, ToString functions return the symbolic name
+ *       of elements with a descriptive string.
+ *
+ * @code
+ * ENUM_IMPL_HOT_COLD(SHAPE_POINTS);
+ * ENUM_DEFINE_TOSTRING(SHAPE_POINTS, Shape_ToString)
+ * ENUM_DEFINE_INDEXOF(SHAPE_POINTS, Shape_IndexOf)
+ * ENUM_DEFINE_DESCRIPTION(SHAPE_POINTS, Shape_Describe, Shape_IndexOf)
+ *
+ * printf("%s: %s\n", Shape_ToString(TRIANGLE), Shape_Describe(TRIANGLE));
+ * // TRIANGLE: Sides of a Triangle
+ * @endcode
+ *
+ */
+#define ENUM_IMPL_HOT_COLD(e) \
+    typedef ptrdiff_t e##_Iterator_t; \
+    static const enum e e##_IMPL[] = \
+    { \
+        e(ENUM_HOT_VALUE, ENUM_HOT_VALUE, ENUM_HOT_VALUE, ENUM_HOT_VALUE) \
+    }; \
+    \
+    static const struct e##_Names \
+    { \
+        e(ENUM_HOT_AS_NAME, ENUM_HOT_AS_NAME, ENUM_HOT_AS_NAME, ENUM_HOT_AS_NAME) \
+    } e##_NAMES = \
+    { \
+        e(ENUM_HOT_INIT_AS_NAME, ENUM_HOT_INIT_AS_NAME, ENUM_HOT_INIT_AS_NAME, ENUM_HOT_INIT_AS_NAME) \
+    }; \
+    \
+    ENUM_COLD_DATA static const struct e##_Descriptions \
+    { \
+        char enum_none_; /* so no description is at offset 0 */ \
+        e(ENUM_COLD_AS_NONE, ENUM_COLD_AS_NONE_VALUE, ENUM_COLD_AS_STRING, ENUM_COLD_AS_VALUE_STRING) \
+    } e##_DESCRIPTIONS = \
+    { \
+        0, \
+        e(ENUM_COLD_INIT_AS_NONE, ENUM_COLD_INIT_AS_NONE_VALUE, ENUM_COLD_INIT_AS_STRING, ENUM_COLD_INIT_AS_VALUE_STRING) \
+    }; \
+    \
+    static inline enum e e##_ValueAt(size_t idx) \
+    { \
+        return e##_IMPL[idx]; \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) \
+    { \
+        /* a fixed block-scope name lets the X-Macros below refer to the pool type */ \
+        typedef struct e##_Names Enum_Names_t; \
+        static const uint32_t offsets[] = \
+        { \
+            e(ENUM_HOT_OFFSET, ENUM_HOT_OFFSET, ENUM_HOT_OFFSET, ENUM_HOT_OFFSET) \
+        }; \
+        \
+        return (char const*) &e##_NAMES + offsets[idx]; \
+    } \
+    \
+    static inline size_t e##_NameLengthAt(size_t idx) \
+    { \
+        typedef struct e##_Names Enum_Names_t; \
+        static const uint32_t lengths[] = \
+        { \
+            e(ENUM_HOT_LENGTH, ENUM_HOT_LENGTH, ENUM_HOT_LENGTH, ENUM_HOT_LENGTH) \
+        }; \
+        \
+        return lengths[idx]; \
+    } \
+    \
+    static inline char const* e##_DescriptionAt(size_t idx) \
+    { \
+        typedef struct e##_Descriptions Enum_Descriptions_t; \
+        ENUM_COLD_DATA static const uint32_t offsets[] = \
+        { \
+            e(ENUM_COLD_OFFSET_NONE, ENUM_COLD_OFFSET_NONE, ENUM_COLD_OFFSET, ENUM_COLD_OFFSET) \
+        }; \
+        \
+        return offsets[idx] == 0 ? e##_NameAt(idx) : (char const*) &e##_DESCRIPTIONS + offsets[idx]; \
+    } \
+    \
+    static inline size_t e##_DescriptionLengthAt(size_t idx) \
+    { \
+        typedef struct e##_Descriptions Enum_Descriptions_t; \
+        ENUM_COLD_DATA static const uint32_t lengths[] = \
+        { \
+            e(ENUM_COLD_LENGTH_NONE, ENUM_COLD_LENGTH_NONE, ENUM_COLD_LENGTH, ENUM_COLD_LENGTH) \
+        }; \
+        \
+        return lengths[idx] == 0 ? e##_NameLengthAt(idx) : lengths[idx] - 1; \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) /* takes the closing semi-colon */
+
+/**
+ * Emit a description function definition @p fname for the enum @p e.
+ *
+ * Returns the descriptive string of @p literal's element, or
+ * @ref ENUM_UNKNOWN_STRING. It is the only function which reads the cold
+ * part of the table, and is marked cold where the compiler supports it.
+ *
+ * @param e An enum name.
+ * @param fname of description function.
+ * @param indexof An IndexOf function for @p e, such as one from
+ *                @ref ENUM_DEFINE_INDEXOF.
+ *
+ * @pre @ref ENUM_IMPL_HOT_COLD declaration must be visible in the current
+ *      context.
+ *
+ * @note No closing semi-colon.
+ * @note Declare with @ref ENUM_DECLARE_TOSTRING.
+ *
+ */
+#define ENUM_DEFINE_DESCRIPTION(e, fname, indexof) \
+    ENUM_COLD_FUNCTION ENUM_DECLARE_TOSTRING(e, fname) \
+    { \
+        e##_Iterator_t idx = indexof(literal); \
+        \
+        if (idx == ENUM_INDEX_UNKNOWN) \
+        { \
+            return ENUM_UNKNOWN_STRING; \
+        } \
+        \
+        return e##_DescriptionAt((size_t) idx); \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal attribute which places a constant table in
+ * @ref ENUM_COLD_SECTION, on ELF targets of GCC compatible compilers.
+ */
+#if defined(__GNUC__) && defined(__ELF__) && !defined(ENUM_NO_COLD_SECTION)
+#define ENUM_COLD_DATA __attribute__((section(ENUM_COLD_SECTION)))
+#else
+#define ENUM_COLD_DATA
+#endif
+
+/**
+ * Internal attribute which marks a function as rarely called, so it is
+ * optimised for size and laid out apart from hot code.
+ */
+#if defined(__GNUC__)
+#define ENUM_COLD_FUNCTION __attribute__((cold))
+#else
+#define ENUM_COLD_FUNCTION
+#endif
+
+/**
+ * Internal X-Macro which emits a value array initializer <tt>(name),</tt>.
+ */
+#define ENUM_HOT_VALUE(...) (ENUM_NAME_OF(__VA_ARGS__)),
+
+/**
+ * Internal X-Macro which emits a hot pool member sized for @p "name", for
+ * every tuple form.
+ *
+ * @code
+ * ENUM_HOT_AS_NAME(TRIANGLE, "Sides of a Triangle") => char TRIANGLE[sizeof("TRIANGLE")];
+ * @endcode
+ */
+#define ENUM_HOT_AS_NAME(...) ENUM_HOT_AS_NAME_I(ENUM_NAME_OF(__VA_ARGS__))
+#define ENUM_HOT_AS_NAME_I(name) ENUM_HOT_AS_NAME_II(name)
+#define ENUM_HOT_AS_NAME_II(name) char name[sizeof(#name)];
+
+/**
+ * Internal X-Macro which emits a hot pool member initializer @p "name", for
+ * every tuple form.
+ *
+ * @code
+ * ENUM_HOT_INIT_AS_NAME(TRIANGLE, "Sides of a Triangle") => "TRIANGLE",
+ * @endcode
+ */
+#define ENUM_HOT_INIT_AS_NAME(...) ENUM_HOT_INIT_AS_NAME_I(ENUM_NAME_OF(__VA_ARGS__))
+#define ENUM_HOT_INIT_AS_NAME_I(name) ENUM_HOT_INIT_AS_NAME_II(name)
+#define ENUM_HOT_INIT_AS_NAME_II(name) #name,
+
+/**
+ * Internal X-Macro which emits the offset of the element's name in the hot
+ * pool.
+ *
+ * @pre @p Enum_Names_t names the hot pool struct in the current scope.
+ */
+#define ENUM_HOT_OFFSET(...) offsetof(Enum_Names_t, ENUM_NAME_OF(__VA_ARGS__)),
+
+/**
+ * Internal X-Macro which emits the length of the element's name in the hot
+ * pool.
+ *
+ * @pre @p Enum_Names_t names the hot pool struct in the current scope.
+ */
+#define ENUM_HOT_LENGTH(...) sizeof(((Enum_Names_t*) 0)->ENUM_NAME_OF(__VA_ARGS__)) - 1,
+
+/**
+ * Internal X-Macros which emit no cold pool member for an element without
+ * a descriptive string.
+ */
+#define ENUM_COLD_AS_NONE(name)
+#define ENUM_COLD_AS_NONE_VALUE(name, unused_value)
+
+/**
+ * Internal X-Macro which emits a cold pool member sized for @p string.
+ *
+ * @code
+ * ENUM_COLD_AS_STRING(TRIANGLE, "Sides of a Triangle")
+ *      => char TRIANGLE[sizeof("Sides of a Triangle")];
+ * @endcode
+ */
+#define ENUM_COLD_AS_STRING(name, string) char name[sizeof(string)];
+
+/**
+ * Internal X-Macro which emits a cold pool member sized for @p string.
+ */
+#define ENUM_COLD_AS_VALUE_STRING(name, unused_value, string) char name[sizeof(string)];
+
+/**
+ * Internal X-Macros which emit no cold pool initializer for an element
+ * without a descriptive string.
+ */
+#define ENUM_COLD_INIT_AS_NONE(name)
+#define ENUM_COLD_INIT_AS_NONE_VALUE(name, unused_value)
+
+/**
+ * Internal X-Macro which emits a cold pool member initializer @p string.
+ */
+#define ENUM_COLD_INIT_AS_STRING(name, string) string,
+
+/**
+ * Internal X-Macro which emits a cold pool member initializer @p string.
+ */
+#define ENUM_COLD_INIT_AS_VALUE_STRING(name, unused_value, string) string,
+
+/**
+ * Internal X-Macro which emits a zero offset or length, for an element
+ * without a descriptive string.
+ */
+#define ENUM_COLD_OFFSET_NONE(...) 0,
+#define ENUM_COLD_LENGTH_NONE(...) 0,
+
+/**
+ * Internal X-Macro which emits the offset of the element's description in
+ * the cold pool.
+ *
+ * @pre @p Enum_Descriptions_t names the cold pool struct in the current
+ *      scope.
+ */
+#define ENUM_COLD_OFFSET(...) offsetof(Enum_Descriptions_t, ENUM_NAME_OF(__VA_ARGS__)),
+
+/**
+ * Internal X-Macro which emits the size of the element's description in
+ * the cold pool, including its NUL, so it is never zero.
+ *
+ * @pre @p Enum_Descriptions_t names the cold pool struct in the current
+ *      scope.
+ */
+#define ENUM_COLD_LENGTH(...) sizeof(((Enum_Descriptions_t*) 0)->ENUM_NAME_OF(__VA_ARGS__)),
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_HOTCOLD_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
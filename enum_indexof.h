@@ -0,0 +1,193 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Value-to-index lookup chosen by the shape of the enum.
+ *
+ * @ref ENUM_DEFINE_INDEXOF emits the inverse of an iterator's @p tovalue
+ * function, using the fastest lookup the enum's values allow:
+ *
+ * - contiguous enums subtract the first value, in O(1);
+ * - monotonic enums binary search @p e_IMPL, in O(log n);
+ * - any other enum probes a value hash table, in O(1) expected.
+ *
+ * The shape is tested with @ref ENUM_IS_CONTIGUOUS and
+ * @ref ENUM_IS_MONOTONIC, which are integer constant expressions, so the
+ * unused lookups are removed by the compiler, and the hash table is only
+ * allocated for enums which need it. For the others, its build function
+ * does nothing, and is removed with the table when optimising.
+ *
+ * The result indexes per-member arrays sized to the member count, which is
+ * the building block for enum-keyed maps, sets and counters.
+ *
+ */
+#ifndef ENUM_INDEXOF_H
+#define ENUM_INDEXOF_H
+
+#include "enum.h"
+#include "enum_contiguous.h"
+#include "enum_monotonic.h"
+
+/**
+ * Emit an IndexOf function definition @p fname for the enum @p e.
+ *
+ * The function returns the iterator of the first element of @p e with value
+ * @p literal, or @ref ENUM_INDEX_UNKNOWN if there is none.
+ *
+ * The hash table of an enum which is neither contiguous nor monotonic is
+ * built on load under GCC compatible compilers, otherwise on the first call,
+ * as for @ref ENUM_DEFINE_FROMSTRING.
+ *
+ * @param e An enum name.
+ * @param fname of IndexOf function.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ *
+ * @note No closing semi-colon.
+ * @note Declare with @ref ENUM_DECLARE_INDEXOF.
+ *
+ * @code
+ * ENUM_IMPL(SHAPE);
+ * ENUM_DEFINE_ITERATOR(SHAPE, Shape_IteratorBegin, Shape_IteratorEnd, Shape_IteratorToValue)
+ * ENUM_DEFINE_INDEXOF(SHAPE, Shape_IndexOf)
+ *
+ * unsigned hits[sizeof(SHAPE_IMPL)/sizeof(*SHAPE_IMPL)] = {0};
+ * hits[Shape_IndexOf(ANTI_LINE)]++;
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_INDEXOF(e, fname) \
+    ENUM_DEFINE_INDEXOF_STORAGE(e, fname, extern, ENUM_INDEXOF_HASHED(e))
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal definition of @ref ENUM_DEFINE_INDEXOF with the storage class
+ * @p storage, @p extern or @p static, of the function.
+ *
+ * @p hashed is an integer constant expression which is non-zero if the
+ * function may be called for an enum which is neither contiguous nor
+ * monotonic. Otherwise the hash table takes one slot and is never built.
+ */
+#define ENUM_DEFINE_INDEXOF_STORAGE(e, fname, storage, hashed) \
+    static size_t fname##_HASH[ENUM_INDEXOF_HASH_SIZE(e, hashed)]; \
+    static int fname##_HASH_BUILT; \
+    \
+    ENUM_AT_LOAD static void fname##_HashInit(void) \
+    { \
+        size_t idx = 0; \
+        \
+        if (!ENUM_INDEXOF_HASHED(e) || !(hashed)) \
+        { \
+            return; \
+        } \
+        \
+        for (idx = 0; idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL); ++idx) \
+        { \
+            size_t slot = Enum_ValueHash((int64_t) e##_ValueAt(idx), \
+                                         sizeof(fname##_HASH)/sizeof(*fname##_HASH)); \
+            \
+            /* an occupied slot holds the same value, declared first */ \
+            while (fname##_HASH[slot] != 0 && e##_ValueAt(fname##_HASH[slot] - 1) != e##_ValueAt(idx)) \
+            { \
+                slot = (slot + 1) & (sizeof(fname##_HASH)/sizeof(*fname##_HASH) - 1); \
+            } \
+            \
+            if (fname##_HASH[slot] == 0) \
+            { \
+                fname##_HASH[slot] = idx + 1; \
+            } \
+        } \
+        \
+        fname##_HASH_BUILT = 1; \
+    } \
+    \
+    storage ENUM_DECLARE_INDEXOF(e, fname) \
+    { \
+        size_t count = sizeof(e##_IMPL)/sizeof(*e##_IMPL); \
+        size_t idx = 0; \
+        \
+        if (ENUM_IS_CONTIGUOUS(e)) \
+        { \
+            idx = (size_t) (literal) - (size_t) e##_ValueAt(0); \
+        } \
+        else if (ENUM_IS_MONOTONIC(e)) \
+        { \
+            ENUM_MONOTONIC_LOWER_BOUND(e, literal, idx); \
+        } \
+        else \
+        { \
+            size_t slot = 0; \
+            \
+            if (!fname##_HASH_BUILT) \
+            { \
+                fname##_HashInit(); \
+            } \
+            \
+            slot = Enum_ValueHash((int64_t) (literal), \
+                                  sizeof(fname##_HASH)/sizeof(*fname##_HASH)); \
+            while (fname##_HASH[slot] != 0 && e##_ValueAt(fname##_HASH[slot] - 1) != (literal)) \
+            { \
+                slot = (slot + 1) & (sizeof(fname##_HASH)/sizeof(*fname##_HASH) - 1); \
+            } \
+            \
+            idx = fname##_HASH[slot] == 0 ? count : fname##_HASH[slot] - 1; \
+        } \
+        \
+        if (idx < count && e##_ValueAt(idx) == (literal)) \
+        { \
+            return (e##_Iterator_t) idx; \
+        } \
+        \
+        return ENUM_INDEX_UNKNOWN; \
+    } \
+
+/**
+ * Internal integer constant expression which is non-zero if IndexOf
+ * functions for the enum @p e use a hash table.
+ */
+#define ENUM_INDEXOF_HASHED(e) \
+    (!ENUM_IS_CONTIGUOUS(e) && !ENUM_IS_MONOTONIC(e))
+
+/**
+ * Internal size of the IndexOf hash table of the enum @p e: one slot for
+ * enums which need none, or if @p hashed is zero, else a power of two of at
+ * least twice the element count.
+ */
+#define ENUM_INDEXOF_HASH_SIZE(e, hashed) \
+    (ENUM_INDEXOF_HASHED(e) && (hashed) ? ENUM_HASH_SIZE(sizeof(e##_IMPL)/sizeof(*e##_IMPL)) : 1)
+
+/**
+ * Internal home slot of @p value in a value hash table of @p size slots, a
+ * power of two, from which probing is linear.
+ *
+ * Fibonacci hashing, which spreads both runs and strides of values. The
+ * slot is the top log2(@p size) bits of the product, which depend on every
+ * bit of @p value.
+ */
+static inline size_t Enum_ValueHash(int64_t value, size_t size)
+{
+    uint64_t hash = (uint64_t) value * UINT64_C(0x9E3779B97F4A7C15);
+
+    return size > 1 ? (size_t) (hash >> (64 - Enum_Ctz64(size))) : 0;
+}
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_INDEXOF_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
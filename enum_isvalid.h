@@ -0,0 +1,235 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Membership tests for untrusted integers.
+ *
+ * Integers decoded from the wire or from files must be checked to be
+ * elements of their enum before they are used as one. @ref ENUM_DEFINE_ISVALID
+ * emits the check as a bit test where possible:
+ *
+ * - if the values span at most 64 integers per element, and at most
+ *   @ref ENUM_ISVALID_BITMAP_MAX integers, a bitmap over <tt>[min, max]</tt>
+ *   answers with one subtraction, one compare and one load, in O(1);
+ * - otherwise the enum's IndexOf function answers, in the time it takes.
+ *
+ * The bitmap takes at most 8 bytes per element, as much as one table entry.
+ *
+ */
+#ifndef ENUM_ISVALID_H
+#define ENUM_ISVALID_H
+
+#include "enum.h"
+
+/**
+ * The widest value range, in integers, for which IsValid functions use a
+ * bitmap. The bitmap takes one bit per integer of static storage.
+ */
+#ifndef ENUM_ISVALID_BITMAP_MAX
+#define ENUM_ISVALID_BITMAP_MAX 65536
+#endif
+
+/**
+ * Emit an IsValid function declaration @p fname for the enum @p e.
+ *
+ * @param e     C-Enum Name.
+ * @param fname IsValid function name.
+ */
+#define ENUM_DECLARE_ISVALID(e, fname) \
+    int fname(int64_t value)
+
+/**
+ * Emit a batch IsValid function declaration @p fname for the enum @p e.
+ *
+ * @param e     C-Enum Name.
+ * @param fname Batch IsValid function name.
+ */
+#define ENUM_DECLARE_ISVALID_BATCH(e, fname) \
+    size_t fname(int64_t const* in, size_t n)
+
+/**
+ * Emit an IsValid function definition @p fname for the enum @p e.
+ *
+ * The function returns non-zero if @p value is the value of an element of
+ * @p e. Values outside the range of @p enum @p e are never valid.
+ *
+ * The bitmap is built on load under GCC compatible compilers, otherwise on
+ * the first call, as for @ref ENUM_DEFINE_FROMSTRING.
+ *
+ * @param e An enum name.
+ * @param fname of IsValid function.
+ * @param indexof An IndexOf function for @p e, such as one from
+ *                @ref ENUM_DEFINE_INDEXOF, used when the values are too
+ *                sparse for a bitmap.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_DEFINE_INDEXOF(MSG_TYPE, MsgType_IndexOf)
+ * ENUM_DEFINE_ISVALID(MSG_TYPE, MsgType_IsValid, MsgType_IndexOf)
+ *
+ * if (!MsgType_IsValid(header.type))
+ * {
+ *     return DECODE_E_BAD_TYPE;
+ * }
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_ISVALID(e, fname, indexof) \
+    static uint64_t fname##_BITS[ENUM_ISVALID_WORDS(e)]; \
+    static int64_t fname##_MIN; \
+    static uint64_t fname##_SPAN; \
+    static int fname##_BITMAP; \
+    static int fname##_BITS_BUILT; \
+    \
+    ENUM_AT_LOAD static void fname##_BitsInit(void) \
+    { \
+        size_t count = sizeof(e##_IMPL)/sizeof(*e##_IMPL); \
+        int64_t max = count > 0 ? (int64_t) e##_ValueAt(0) : 0; \
+        size_t idx = 0; \
+        \
+        fname##_MIN = max; \
+        for (idx = 1; idx < count; ++idx) \
+        { \
+            int64_t value = (int64_t) e##_ValueAt(idx); \
+            \
+            fname##_MIN = value < fname##_MIN ? value : fname##_MIN; \
+            max = value > max ? value : max; \
+        } \
+        \
+        fname##_SPAN = (uint64_t) max - (uint64_t) fname##_MIN; \
+        fname##_BITMAP = fname##_SPAN < 64 * (uint64_t) (sizeof(fname##_BITS)/sizeof(*fname##_BITS)); \
+        \
+        for (idx = 0; fname##_BITMAP && idx < count; ++idx) \
+        { \
+            uint64_t offset = (uint64_t) (int64_t) e##_ValueAt(idx) - (uint64_t) fname##_MIN; \
+            \
+            fname##_BITS[offset / 64] |= (uint64_t) 1 << (offset % 64); \
+        } \
+        \
+        fname##_BITS_BUILT = 1; \
+    } \
+    \
+    ENUM_DECLARE_ISVALID(e, fname) \
+    { \
+        uint64_t offset = 0; \
+        \
+        if (!fname##_BITS_BUILT) \
+        { \
+            fname##_BitsInit(); \
+        } \
+        \
+        offset = (uint64_t) value - (uint64_t) fname##_MIN; \
+        if (fname##_BITMAP) \
+        { \
+            return offset <= fname##_SPAN && (fname##_BITS[offset / 64] >> (offset % 64) & 1) != 0; \
+        } \
+        \
+        return offset <= fname##_SPAN \
+               && (int64_t) (enum e) value == value \
+               && indexof((enum e) value) != ENUM_INDEX_UNKNOWN; \
+    } \
+
+/**
+ * Emit a batch IsValid function definition @p fname for the enum @p e.
+ *
+ * The function checks the @p n values at @p in and returns the index of the
+ * first which is not the value of an element, or @p n if all are. Where
+ * @p isvalid uses a bitmap, the bitmap is tested inline, eight values at a
+ * time without branching on each; otherwise each value is passed to
+ * @p isvalid in turn.
+ *
+ * @param e An enum name.
+ * @param fname of batch IsValid function.
+ * @param isvalid An IsValid function for @p e, from
+ *                @ref ENUM_DEFINE_ISVALID.
+ *
+ * @pre @ref ENUM_DEFINE_ISVALID of @p isvalid must be visible in the current
+ *      context.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_DEFINE_ISVALID_BATCH(MSG_TYPE, MsgType_IsValidBatch, MsgType_IsValid)
+ *
+ * size_t bad = MsgType_IsValidBatch(types, count);
+ * if (bad != count)
+ * {
+ *     printf("Record %zu has unknown type %lld\n", bad, (long long) types[bad]);
+ * }
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_ISVALID_BATCH(e, fname, isvalid) \
+    ENUM_DECLARE_ISVALID_BATCH(e, fname) \
+    { \
+        size_t idx = 0; \
+        \
+        if (!isvalid##_BITS_BUILT) \
+        { \
+            isvalid##_BitsInit(); \
+        } \
+        \
+        for (idx = 0; isvalid##_BITMAP && idx + 8 <= n; idx += 8) \
+        { \
+            uint64_t valid = 1; \
+            size_t lane = 0; \
+            \
+            for (lane = 0; lane < 8; ++lane) \
+            { \
+                uint64_t offset = (uint64_t) in[idx + lane] - (uint64_t) isvalid##_MIN; \
+                uint64_t in_span = offset <= isvalid##_SPAN; \
+                \
+                /* out of span values test bit 0 of word 0, then are masked out */ \
+                offset &= -in_span; \
+                valid &= in_span & isvalid##_BITS[offset / 64] >> (offset % 64); \
+            } \
+            \
+            if (!valid) \
+            { \
+                break; \
+            } \
+        } \
+        \
+        for (; idx < n; ++idx) \
+        { \
+            if (!isvalid(in[idx])) \
+            { \
+                break; \
+            } \
+        } \
+        \
+        return idx; \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal size in words of the IsValid bitmap of @p e: one per element, to
+ * at most @ref ENUM_ISVALID_BITMAP_MAX bits, and at least one.
+ */
+#define ENUM_ISVALID_WORDS(e) \
+    (ENUM_COUNT(e) == 0 ? 1 \
+     : ENUM_COUNT(e) < ENUM_ISVALID_BITMAP_MAX / 64 ? ENUM_COUNT(e) : ENUM_ISVALID_BITMAP_MAX / 64)
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_ISVALID_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
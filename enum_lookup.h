@@ -0,0 +1,255 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Compile-time enum traits, and the value lookup they select.
+ *
+ * The shape of an enum is known when it is compiled. With @ref ENUM_TRAITS
+ * visible, each of these is an integer constant expression:
+ *
+ * - @ref ENUM_COUNT, the number of elements;
+ * - @ref ENUM_MIN_VALUE and @ref ENUM_MAX_VALUE, the value range;
+ * - @ref ENUM_SPAN, the number of integers in that range;
+ * - @ref ENUM_IS_CONTIGUOUS, @ref ENUM_IS_MONOTONIC and @ref ENUM_IS_DENSE;
+ * - @ref ENUM_LOOKUP_MODE_OF, the lookup those select.
+ *
+ * @ref ENUM_DEFINE_LOOKUP emits an IndexOf function using that lookup:
+ *
+ * - contiguous enums subtract the first value, in O(1);
+ * - dense enums, whose values fill at least a quarter of their range, index
+ *   a table over the range, in O(1);
+ * - other monotonic enums binary search @p e_IMPL, in O(log n);
+ * - any other enum probes a value hash table, in O(1) expected.
+ *
+ * Debug builds check the traits against @p e_IMPL at startup with
+ * @ref ENUM_CHECK_TRAITS, which catches values the enumerators behind
+ * @ref ENUM_MIN_VALUE and @ref ENUM_MAX_VALUE cannot hold.
+ *
+ */
+#ifndef ENUM_LOOKUP_H
+#define ENUM_LOOKUP_H
+
+#include <assert.h>
+
+#include "enum.h"
+#include "enum_contiguous.h"
+#include "enum_monotonic.h"
+#include "enum_indexof.h"
+
+/**
+ * The widest value range, in integers, for which lookups use a dense table.
+ * The table takes four bytes per integer of static storage.
+ */
+#ifndef ENUM_LOOKUP_DENSE_MAX
+#define ENUM_LOOKUP_DENSE_MAX 65536
+#endif
+
+/**
+ * Lookups selected by @ref ENUM_LOOKUP_MODE_OF.
+ */
+#define ENUM_LOOKUP_MODE(_, _V, _S, _VS) \
+    _S(ENUM_LOOKUP_CONTIGUOUS, "Contiguous") \
+    _S(ENUM_LOOKUP_DENSE, "Dense table") \
+    _S(ENUM_LOOKUP_BINARY, "Binary search") \
+    _S(ENUM_LOOKUP_HASH, "Hash table") \
+
+/**
+ * The C-Enum lookup mode enum.
+ */
+ENUM(ENUM_LOOKUP_MODE);
+
+/**
+ * Integer constant expression for the number of integers from the least to
+ * the greatest value of the enum @p e, inclusive.
+ *
+ * @param e A C-Enum list.
+ *
+ * @pre @ref ENUM_TRAITS of @p e is visible.
+ */
+#define ENUM_SPAN(e) \
+    ((long long) ENUM_MAX_VALUE(e) - (long long) ENUM_MIN_VALUE(e) + 1)
+
+/**
+ * Integer constant expression which is non-zero if the values of the enum
+ * @p e fill at least a quarter of at most @ref ENUM_LOOKUP_DENSE_MAX
+ * integers.
+ *
+ * A dense table over such a range takes at most 16 bytes per element, as
+ * much as one @p e_IMPL entry.
+ *
+ * @param e A C-Enum list.
+ *
+ * @pre @ref ENUM_TRAITS of @p e is visible.
+ */
+#define ENUM_IS_DENSE(e) \
+    (ENUM_SPAN(e) <= 4LL * ENUM_COUNT(e) && ENUM_SPAN(e) <= ENUM_LOOKUP_DENSE_MAX)
+
+/**
+ * Integer constant expression for the @ref ENUM_LOOKUP_MODE which
+ * @ref ENUM_DEFINE_LOOKUP uses for the enum @p e.
+ *
+ * @param e A C-Enum list.
+ *
+ * @pre @ref ENUM_TRAITS of @p e is visible.
+ *
+ * @code
+ * ENUM_TRAITS(ERROR);
+ *
+ * typedef char error_lookup_is_o1[ENUM_LOOKUP_MODE_OF(ERROR) <= ENUM_LOOKUP_DENSE ? 1 : -1];
+ * @endcode
+ */
+#define ENUM_LOOKUP_MODE_OF(e) \
+    (ENUM_IS_CONTIGUOUS(e) ? ENUM_LOOKUP_CONTIGUOUS \
+     : ENUM_IS_DENSE(e) ? ENUM_LOOKUP_DENSE \
+     : ENUM_IS_MONOTONIC(e) ? ENUM_LOOKUP_BINARY \
+     : ENUM_LOOKUP_HASH)
+
+/**
+ * Statement which asserts the compile-time traits of the enum @p e agree
+ * with its table. Expands to nothing if @p NDEBUG is defined.
+ *
+ * @param e An enum name.
+ *
+ * @pre @ref ENUM_TRAITS of @p e and @ref ENUM_IMPL declaration must be
+ *      visible in the current context.
+ */
+#ifndef NDEBUG
+#define ENUM_CHECK_TRAITS(e) \
+    do \
+    { \
+        int64_t min_ = (int64_t) e##_ValueAt(0); \
+        int64_t max_ = min_; \
+        int contiguous_ = 1; \
+        int monotonic_ = 1; \
+        size_t idx_ = 0; \
+        \
+        for (idx_ = 1; idx_ < sizeof(e##_IMPL)/sizeof(*e##_IMPL); ++idx_) \
+        { \
+            int64_t prev_ = (int64_t) e##_ValueAt(idx_ - 1); \
+            int64_t value_ = (int64_t) e##_ValueAt(idx_); \
+            \
+            contiguous_ &= value_ == prev_ + 1; \
+            monotonic_ &= prev_ <= value_; \
+            min_ = value_ < min_ ? value_ : min_; \
+            max_ = value_ > max_ ? value_ : max_; \
+        } \
+        \
+        assert(ENUM_COUNT(e) == sizeof(e##_IMPL)/sizeof(*e##_IMPL)); \
+        assert(ENUM_MIN_VALUE(e) == min_); \
+        assert(ENUM_MAX_VALUE(e) == max_); \
+        assert(!ENUM_IS_CONTIGUOUS(e) == !contiguous_); \
+        assert(!ENUM_IS_MONOTONIC(e) == !monotonic_); \
+    } while (0)
+#else
+#define ENUM_CHECK_TRAITS(e) ((void) 0)
+#endif
+
+/**
+ * Emit an IndexOf function definition @p fname for the enum @p e, using the
+ * lookup selected by @ref ENUM_LOOKUP_MODE_OF.
+ *
+ * The function returns the iterator of the first element of @p e with value
+ * @p literal, or @ref ENUM_INDEX_UNKNOWN if there is none, as for
+ * @ref ENUM_DEFINE_INDEXOF.
+ *
+ * Only the table of the selected lookup is sized and built, on load under
+ * GCC compatible compilers, otherwise on the first call which needs it. The
+ * traits are checked on load.
+ *
+ * @param e An enum name.
+ * @param fname of IndexOf function.
+ *
+ * @pre @ref ENUM_TRAITS of @p e and @ref ENUM_IMPL declaration must be
+ *      visible in the current context.
+ *
+ * @note No closing semi-colon.
+ * @note Declare with @ref ENUM_DECLARE_INDEXOF.
+ *
+ * @code
+ * ENUM_IMPL(ERROR);
+ * ENUM_TRAITS(ERROR);
+ * ENUM_DEFINE_LOOKUP(ERROR, Error_IndexOf)
+ *
+ * unsigned hits[ENUM_COUNT(ERROR)] = {0};
+ * hits[Error_IndexOf(ERROR_TIMEOUT)]++;
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_LOOKUP(e, fname) \
+    ENUM_DEFINE_INDEXOF_STORAGE(e, fname##_Sparse, static, ENUM_LOOKUP_MODE_OF(e) == ENUM_LOOKUP_HASH) \
+    \
+    static uint32_t fname##_DENSE[ENUM_LOOKUP_DENSE_SIZE(e)]; \
+    static int fname##_DENSE_BUILT; \
+    \
+    ENUM_AT_LOAD static void fname##_DenseInit(void) \
+    { \
+        size_t idx = 0; \
+        \
+        ENUM_CHECK_TRAITS(e); \
+        \
+        if (ENUM_LOOKUP_MODE_OF(e) != ENUM_LOOKUP_DENSE) \
+        { \
+            return; \
+        } \
+        \
+        for (idx = 0; idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL); ++idx) \
+        { \
+            size_t offset = (size_t) ((int64_t) e##_ValueAt(idx) - (int64_t) ENUM_MIN_VALUE(e)); \
+            \
+            if (fname##_DENSE[offset] == 0) \
+            { \
+                fname##_DENSE[offset] = (uint32_t) idx + 1; \
+            } \
+        } \
+        \
+        fname##_DENSE_BUILT = 1; \
+    } \
+    \
+    ENUM_DECLARE_INDEXOF(e, fname) \
+    { \
+        if (ENUM_LOOKUP_MODE_OF(e) == ENUM_LOOKUP_DENSE) \
+        { \
+            uint64_t offset = (uint64_t) (int64_t) (literal) - (uint64_t) (int64_t) ENUM_MIN_VALUE(e); \
+            \
+            if (!fname##_DENSE_BUILT) \
+            { \
+                fname##_DenseInit(); \
+            } \
+            \
+            /* an empty entry is 0, so reads as ENUM_INDEX_UNKNOWN */ \
+            return offset < sizeof(fname##_DENSE)/sizeof(*fname##_DENSE) \
+                   ? (e##_Iterator_t) fname##_DENSE[offset] - 1 \
+                   : ENUM_INDEX_UNKNOWN; \
+        } \
+        \
+        return fname##_Sparse(literal); \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal size of the dense lookup table of the enum @p e: its span for
+ * dense enums, else one entry.
+ */
+#define ENUM_LOOKUP_DENSE_SIZE(e) \
+    (ENUM_LOOKUP_MODE_OF(e) == ENUM_LOOKUP_DENSE ? (size_t) ENUM_SPAN(e) : 1)
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_LOOKUP_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
@@ -0,0 +1,133 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Dense maps keyed by enum values.
+ *
+ * A map holds one value per element of the enum in a single array, sized by
+ * @ref ENUM_COUNT and ordered as the elements are declared. A key is turned
+ * into its array index by an IndexOf function, so get and set are O(1) for
+ * any enum shape that @ref ENUM_DEFINE_INDEXOF supports, including sparse
+ * and negative values.
+ *
+ * The map is iterated with the enum's iterator: @p values[iter] is the value
+ * of the key <tt>tovalue(iter)</tt>.
+ *
+ * Elements which share a value with an earlier element share its key, so
+ * their array entries are only reachable by index.
+ *
+ */
+#ifndef ENUM_MAP_H
+#define ENUM_MAP_H
+
+#include "enum.h"
+
+/**
+ * Emit the map type @p map_t and its function declarations for the enum
+ * @p e.
+ *
+ * @param e       C-Enum Name.
+ * @param map     Map name, which prefixes the type and functions.
+ * @param value_t Type of the mapped values.
+ *
+ * @note Needs only @ref ENUM, so may be used in headers.
+ *
+ * @code
+ * ENUM_DECLARE_MAP(SHAPE, ShapeSides, unsigned);
+ *
+ * ShapeSides_t sides = {{0}};
+ * @endcode
+ */
+#define ENUM_DECLARE_MAP(e, map, value_t) \
+    typedef struct \
+    { \
+        value_t values[ENUM_COUNT(e)]; \
+    } map##_t; \
+    \
+    value_t* map##_At(map##_t* self, enum e key); \
+    enum ENUM_STATUS map##_Get(map##_t const* self, enum e key, value_t* value); \
+    enum ENUM_STATUS map##_Set(map##_t* self, enum e key, value_t value) \
+
+/**
+ * Emit the function definitions of the map @p map for the enum @p e.
+ *
+ * - @p map_At returns a pointer to the value of @p key, or @p NULL if
+ *   @p key is not an element.
+ * - @p map_Get stores the value of @p key to @p value.
+ * - @p map_Set stores @p value as the value of @p key.
+ *
+ * @p map_Get and @p map_Set return @ref ENUM_OK, or @ref ENUM_E_UNKNOWN if
+ * @p key is not an element.
+ *
+ * @param e       An enum name.
+ * @param map     Map name, as passed to @ref ENUM_DECLARE_MAP.
+ * @param value_t Type of the mapped values.
+ * @param indexof An IndexOf function for @p e, such as one from
+ *                @ref ENUM_DEFINE_INDEXOF.
+ *
+ * @pre @ref ENUM_DECLARE_MAP for @p map must be visible in the current
+ *      context.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_IMPL(SHAPE);
+ * ENUM_DEFINE_INDEXOF(SHAPE, Shape_IndexOf)
+ * ENUM_DEFINE_ITERATOR(SHAPE, Shape_IteratorBegin, Shape_IteratorEnd, Shape_IteratorToValue)
+ * ENUM_DEFINE_MAP(SHAPE, ShapeSides, unsigned, Shape_IndexOf)
+ *
+ * ShapeSides_Set(&sides, ANTI_LINE, 2);
+ *
+ * for (iter = Shape_IteratorBegin(); iter <= Shape_IteratorEnd(); iter++)
+ * {
+ *     printf("%d: %u\n", Shape_IteratorToValue(iter), sides.values[iter]);
+ * }
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_MAP(e, map, value_t, indexof) \
+    value_t* map##_At(map##_t* self, enum e key) \
+    { \
+        e##_Iterator_t idx = indexof(key); \
+        \
+        return idx == ENUM_INDEX_UNKNOWN ? NULL : &self->values[idx]; \
+    } \
+    \
+    enum ENUM_STATUS map##_Get(map##_t const* self, enum e key, value_t* value) \
+    { \
+        e##_Iterator_t idx = indexof(key); \
+        \
+        if (idx == ENUM_INDEX_UNKNOWN) \
+        { \
+            return ENUM_E_UNKNOWN; \
+        } \
+        \
+        *(value) = self->values[idx]; \
+        return ENUM_OK; \
+    } \
+    \
+    enum ENUM_STATUS map##_Set(map##_t* self, enum e key, value_t value) \
+    { \
+        e##_Iterator_t idx = indexof(key); \
+        \
+        ENUM_STATIC_ASSERT(sizeof(self->values)/sizeof(*self->values) \
+                           == sizeof(e##_IMPL)/sizeof(*e##_IMPL)); \
+        \
+        if (idx == ENUM_INDEX_UNKNOWN) \
+        { \
+            return ENUM_E_UNKNOWN; \
+        } \
+        \
+        self->values[idx] = value; \
+        return ENUM_OK; \
+    } \
+
+#endif /* ENUM_MAP_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
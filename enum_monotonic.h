@@ -0,0 +1,183 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Binary-search ToString and IndexOf for monotonic enums.
+ *
+ * An enum is monotonic when its values never decrease in declaration order:
+ *
+ * <tt>For all (x, y) s.t. x <= y, [x] <= [y]</tt>
+ *
+ * The @p e_IMPL table emitted by @ref ENUM_IMPL of such an enum is sorted, so
+ * lookups can binary search it in O(log n), however sparse the values are.
+ *
+ * Elements sharing a value are resolved to the first one declared, which is
+ * also the element @ref ENUM_DEFINE_TOSTRING finds. (Issue #1)
+ *
+ */
+#ifndef ENUM_MONOTONIC_H
+#define ENUM_MONOTONIC_H
+
+#include "enum.h"
+
+/**
+ * Integer constant expression which is non-zero if the enum @p e is
+ * monotonic.
+ *
+ * @param e A C-Enum list.
+ *
+ * @note Not usable in @p \#if, since it refers to enum constants.
+ *
+ * @code
+ * typedef char error_is_sorted[ENUM_IS_MONOTONIC(ERROR) ? 1 : -1];
+ * @endcode
+ */
+#define ENUM_IS_MONOTONIC(e) \
+    (((ENUM_FIRST_VALUE(e)) <= \
+        e(ENUM_MONOTONIC_LINK, ENUM_MONOTONIC_LINK, ENUM_MONOTONIC_LINK, ENUM_MONOTONIC_LINK) \
+    (ENUM_LAST_VALUE(e))))
+
+/**
+ * Emit a binary-search ToString function definition @p fname for the
+ * monotonic enum @p e.
+ *
+ * Returns the same strings as @ref ENUM_DEFINE_TOSTRING.
+ *
+ * @param e An enum name.
+ * @param fname of ToString function.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ * @pre @p e must be monotonic, which is checked at compile time.
+ *
+ * @note No closing semi-colon.
+ * @note Declare with @ref ENUM_DECLARE_TOSTRING.
+ *
+ * @code
+ * #define ERROR(_, _V, _S, _VS) \
+ *     _V(ERROR_BUSY, 1) \
+ *     _(ERROR_TIMEOUT) \
+ *     _V(ERROR_NO_ROUTE, 100) \
+ *     _V(ERROR_INTERNAL, 4000) \
+ *
+ * ENUM(ERROR);
+ * ENUM_IMPL(ERROR);
+ * ENUM_DEFINE_TOSTRING_MONOTONIC(ERROR, Error_ToString)
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_TOSTRING_MONOTONIC(e, fname) \
+    ENUM_DECLARE_TOSTRING(e, fname) \
+    { \
+        size_t idx; \
+        \
+        ENUM_STATIC_ASSERT(ENUM_IS_MONOTONIC(e)); \
+        ENUM_MONOTONIC_LOWER_BOUND(e, literal, idx); \
+        \
+        if (idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL) \
+            && (literal) == e##_ValueAt(idx)) \
+        { \
+            return e##_NameAt(idx); \
+        } \
+        \
+        return ENUM_UNKNOWN_STRING; \
+    } \
+
+/**
+ * Emit a binary-search IndexOf function definition @p fname for the
+ * monotonic enum @p e.
+ *
+ * @param e An enum name.
+ * @param fname of IndexOf function.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ * @pre @p e must be monotonic, which is checked at compile time.
+ *
+ * @note No closing semi-colon.
+ * @note Declare with @ref ENUM_DECLARE_INDEXOF.
+ *
+ * @code
+ * ENUM_IMPL(ERROR);
+ * ...
+ * ENUM_DEFINE_INDEXOF_MONOTONIC(ERROR, Error_IndexOf)
+ *
+ * ERROR_Iterator_t iter = Error_IndexOf(ERROR_NO_ROUTE); // 2
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_INDEXOF_MONOTONIC(e, fname) \
+    ENUM_DECLARE_INDEXOF(e, fname) \
+    { \
+        size_t idx; \
+        \
+        ENUM_STATIC_ASSERT(ENUM_IS_MONOTONIC(e)); \
+        ENUM_MONOTONIC_LOWER_BOUND(e, literal, idx); \
+        \
+        if (idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL) \
+            && (literal) == e##_ValueAt(idx)) \
+        { \
+            return (e##_Iterator_t) idx; \
+        } \
+        \
+        return ENUM_INDEX_UNKNOWN; \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal X-Macro link which emits <tt>(name)) && ((name) <=</tt>.
+ *
+ * Chains adjacent elements into <tt>((a) <= (b))</tt> terms.
+ *
+ * @see ENUM_IS_MONOTONIC
+ */
+#define ENUM_MONOTONIC_LINK(...) \
+    (ENUM_NAME_OF(__VA_ARGS__))) && ((ENUM_NAME_OF(__VA_ARGS__)) <=
+
+/**
+ * Internal statement which sets @p idx to the index of the first element of
+ * @p e whose value is not less than @p literal.
+ *
+ * @p idx is the element count if there is no such element.
+ *
+ * @pre @p e is monotonic, which the caller checks.
+ */
+#define ENUM_MONOTONIC_LOWER_BOUND(e, literal, idx) \
+    do \
+    { \
+        size_t hi_ = sizeof(e##_IMPL)/sizeof(*e##_IMPL); \
+        \
+        (idx) = 0; \
+        while ((idx) < hi_) \
+        { \
+            size_t mid_ = (idx) + (hi_ - (idx)) / 2; \
+            \
+            if (e##_ValueAt(mid_) < (literal)) \
+            { \
+                (idx) = mid_ + 1; \
+            } \
+            else \
+            { \
+                hi_ = mid_; \
+            } \
+        } \
+    } while (0)
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_MONOTONIC_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
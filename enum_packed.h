@@ -0,0 +1,252 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Bit-packed arrays of enum values.
+ *
+ * A packed array stores each value as the iterator index of its element in
+ * @ref ENUM_PACKED_BITS bits, <tt>ceil(log2(count))</tt>, rather than in a
+ * whole @p int. The width is computed from @ref ENUM_COUNT, so adding
+ * elements to the enum widens the encoding with no other change.
+ *
+ * Elements never straddle a word: each 64-bit word holds
+ * @ref ENUM_PACKED_PER_WORD elements, so get and set read one word, and the
+ * index arithmetic divides by constants. Up to @p bits - 1 bits of each word
+ * go unused, at most one bit per element.
+ *
+ * The words are supplied by the caller, so a packed array never allocates;
+ * size them with @ref ENUM_PACKED_WORDS.
+ *
+ * Elements which share a value with an earlier element are stored as, and
+ * decode to, that element.
+ *
+ */
+#ifndef ENUM_PACKED_H
+#define ENUM_PACKED_H
+
+#include "enum.h"
+
+/**
+ * Integer constant expression for the number of bits per element of a
+ * packed array of the enum @p e: <tt>ceil(log2(count))</tt>, and at least
+ * one.
+ *
+ * @param e A C-Enum list.
+ */
+#define ENUM_PACKED_BITS(e) \
+    (ENUM_CEIL_LOG2(ENUM_COUNT(e)) + (ENUM_COUNT(e) == 1))
+
+/**
+ * Integer constant expression for the number of elements in each 64-bit
+ * word of a packed array of the enum @p e.
+ *
+ * @param e A C-Enum list.
+ */
+#define ENUM_PACKED_PER_WORD(e) (64 / ENUM_PACKED_BITS(e))
+
+/**
+ * Number of 64-bit words which hold @p n elements of a packed array of the
+ * enum @p e. An integer constant expression if @p n is.
+ *
+ * @param e A C-Enum list.
+ * @param n Element count.
+ *
+ * @code
+ * static uint64_t status_words[ENUM_PACKED_WORDS(STATUS, 1000000)];
+ * @endcode
+ */
+#define ENUM_PACKED_WORDS(e, n) \
+    (((n) + ENUM_PACKED_PER_WORD(e) - 1) / ENUM_PACKED_PER_WORD(e))
+
+/**
+ * Emit the packed array type @p packed_t and its function declarations for
+ * the enum @p e.
+ *
+ * @param e      C-Enum Name.
+ * @param packed Packed array name, which prefixes the type and functions.
+ *
+ * @note Needs only @ref ENUM, so may be used in headers.
+ *
+ * @code
+ * ENUM_DECLARE_PACKED(STATUS, StatusColumn);
+ * @endcode
+ */
+#define ENUM_DECLARE_PACKED(e, packed) \
+    typedef struct \
+    { \
+        uint64_t* words; \
+        size_t capacity; /* in elements */ \
+        size_t length; /* in elements */ \
+    } packed##_t; \
+    \
+    void packed##_Init(packed##_t* self, uint64_t* words, size_t nwords); \
+    enum e packed##_Get(packed##_t const* self, size_t at); \
+    enum ENUM_STATUS packed##_Set(packed##_t* self, size_t at, enum e literal); \
+    size_t packed##_Append(packed##_t* self, enum e const* in, size_t n); \
+    size_t packed##_Decode(packed##_t const* self, size_t first, size_t n, enum e* out) \
+
+/**
+ * Emit the function definitions of the packed array @p packed for the enum
+ * @p e.
+ *
+ * - @p packed_Init makes @p self an empty array over the @p nwords words at
+ *   @p words, whose contents need not be initialised.
+ * - @p packed_Get returns the value at @p at, in O(1).
+ * - @p packed_Set stores @p literal at @p at, in O(1), and returns
+ *   @ref ENUM_OK, or @ref ENUM_E_UNKNOWN, storing nothing, if @p literal is
+ *   not an element.
+ * - @p packed_Append appends the @p n values at @p in, looking up each run
+ *   of equal values once. It stops at the first value which is not an
+ *   element, or when the array is full, and returns the number appended.
+ * - @p packed_Decode stores the values from @p first, up to @p n of them,
+ *   to @p out a word at a time, and returns the number stored.
+ *
+ * @param e       An enum name.
+ * @param packed  Packed array name, as passed to @ref ENUM_DECLARE_PACKED.
+ * @param indexof An IndexOf function for @p e, such as one from
+ *                @ref ENUM_DEFINE_INDEXOF.
+ *
+ * @pre @ref ENUM_DECLARE_PACKED for @p packed must be visible in the
+ *      current context.
+ * @pre @p at is less than @p length.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_IMPL(STATUS);
+ * ENUM_DEFINE_INDEXOF(STATUS, Status_IndexOf)
+ * ENUM_DEFINE_PACKED(STATUS, StatusColumn, Status_IndexOf)
+ *
+ * StatusColumn_t column;
+ * enum STATUS chunk[4096];
+ *
+ * StatusColumn_Init(&column, status_words, sizeof(status_words)/sizeof(*status_words));
+ * StatusColumn_Append(&column, parsed, parsed_count);
+ *
+ * for (at = 0; at < column.length; at += 4096)
+ * {
+ *     size_t n = StatusColumn_Decode(&column, at, 4096, chunk);
+ *     ...
+ * }
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_PACKED(e, packed, indexof) \
+    void packed##_Init(packed##_t* self, uint64_t* words, size_t nwords) \
+    { \
+        self->words = words; \
+        self->capacity = nwords * ENUM_PACKED_PER_WORD(e); \
+        self->length = 0; \
+    } \
+    \
+    enum e packed##_Get(packed##_t const* self, size_t at) \
+    { \
+        uint64_t word = self->words[at / ENUM_PACKED_PER_WORD(e)]; \
+        \
+        word >>= at % ENUM_PACKED_PER_WORD(e) * ENUM_PACKED_BITS(e); \
+        return e##_ValueAt((size_t) (word & ENUM_PACKED_MASK(e))); \
+    } \
+    \
+    enum ENUM_STATUS packed##_Set(packed##_t* self, size_t at, enum e literal) \
+    { \
+        e##_Iterator_t idx = indexof(literal); \
+        \
+        if (idx == ENUM_INDEX_UNKNOWN) \
+        { \
+            return ENUM_E_UNKNOWN; \
+        } \
+        \
+        ENUM_PACKED_STORE(e, self->words, at, idx); \
+        return ENUM_OK; \
+    } \
+    \
+    size_t packed##_Append(packed##_t* self, enum e const* in, size_t n) \
+    { \
+        e##_Iterator_t idx = ENUM_INDEX_UNKNOWN; \
+        size_t done = 0; \
+        \
+        ENUM_STATIC_ASSERT(ENUM_COUNT(e) == sizeof(e##_IMPL)/sizeof(*e##_IMPL)); \
+        \
+        for (done = 0; done < n && self->length < self->capacity; ++done) \
+        { \
+            if (done == 0 || in[done] != in[done - 1]) \
+            { \
+                idx = indexof(in[done]); \
+            } \
+            \
+            if (idx == ENUM_INDEX_UNKNOWN) \
+            { \
+                break; \
+            } \
+            \
+            ENUM_PACKED_STORE(e, self->words, self->length, idx); \
+            self->length++; \
+        } \
+        \
+        return done; \
+    } \
+    \
+    size_t packed##_Decode(packed##_t const* self, size_t first, size_t n, enum e* out) \
+    { \
+        size_t at = first; \
+        size_t stop = first; \
+        \
+        if (first < self->length) \
+        { \
+            stop = self->length - first < n ? self->length : first + n; \
+        } \
+        \
+        while (at < stop) \
+        { \
+            size_t slot = at % ENUM_PACKED_PER_WORD(e); \
+            uint64_t word = self->words[at / ENUM_PACKED_PER_WORD(e)] >> (slot * ENUM_PACKED_BITS(e)); \
+            \
+            for (; slot < ENUM_PACKED_PER_WORD(e) && at < stop; ++slot, ++at) \
+            { \
+                *out++ = e##_ValueAt((size_t) (word & ENUM_PACKED_MASK(e))); \
+                word >>= ENUM_PACKED_BITS(e); \
+            } \
+        } \
+        \
+        return stop - first; \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal mask of the low @ref ENUM_PACKED_BITS bits.
+ */
+#define ENUM_PACKED_MASK(e) (((uint64_t) 1 << ENUM_PACKED_BITS(e)) - 1)
+
+/**
+ * Internal statement which stores the iterator @p idx at element @p at of
+ * the packed words @p words of the enum @p e.
+ */
+#define ENUM_PACKED_STORE(e, words, at, idx) \
+    do \
+    { \
+        uint64_t* word_ = &(words)[(at) / ENUM_PACKED_PER_WORD(e)]; \
+        unsigned shift_ = (unsigned) ((at) % ENUM_PACKED_PER_WORD(e) * ENUM_PACKED_BITS(e)); \
+        \
+        *word_ = (*word_ & ~(ENUM_PACKED_MASK(e) << shift_)) | ((uint64_t) (idx) << shift_); \
+    } while (0)
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_PACKED_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
@@ -0,0 +1,248 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Relocation-free string-pool table layout.
+ *
+ * The (value, "name") table emitted by @ref ENUM_IMPL holds a pointer per
+ * element. On 64-bit targets each entry is padded to 16 bytes, and in
+ * position-independent code every pointer needs a dynamic relocation, so the
+ * table is written at load time and dirties a page in every process.
+ *
+ * @ref ENUM_IMPL_POOL instead concatenates all names into one constant
+ * character pool and keeps a 16- or 32-bit offset and length per element,
+ * alongside a separate array of values: 8 bytes per element, besides the
+ * names, with @p uint16_t offsets, or 12 with @p uint32_t, rather than 16.
+ * All the tables are fully read-only and need no relocations.
+ *
+ * The layout emits the same @p e_Iterator_t, @p e_IMPL count and
+ * @p e_ValueAt / @p e_NameAt accessors as @ref ENUM_IMPL, so the ToString,
+ * FromString and iterator functions work unchanged with either.
+ *
+ */
+#ifndef ENUM_POOL_H
+#define ENUM_POOL_H
+
+#include "enum.h"
+
+/**
+ * Allocates a string-pool data table for the enum @p e.
+ *
+ * A drop-in alternative to @ref ENUM_IMPL. It emits @p e_POOL, a constant
+ * struct of NUL terminated names, @p e_IMPL, a static constant array of
+ * values, and the @p e_ValueAt, @p e_NameAt and @p e_NameLengthAt
+ * accessors, which find each name by its offset into @p e_POOL and its
+ * length by the size of its member.
+ *
+ * @param e        A C-Enum list. Descriptive strings must be string
+ *                 literals.
+ * @param offset_t An unsigned integer type for name offsets, such as
+ *                 @p uint16_t or @p uint32_t. Checked at compile time to
+ *                 reach every name.
+ *
+ * @note This is a required pre-declaration for all ENUM_DEFINE_* macros, in
+ *       place of @ref ENUM_IMPL.
+ *
+ * @code
+ * ENUM_IMPL_POOL(SHAPE_POINTS, uint16_t);
+ * ENUM_DEFINE_TOSTRING(SHAPE_POINTS, Shape_ToString)
+ * @endcode
+ *
+ */
+#define ENUM_IMPL_POOL(e, offset_t) \
+    typedef ptrdiff_t e##_Iterator_t; \
+    static const struct e##_Pool \
+    { \
+        e(ENUM_POOL_AS_NAME, ENUM_POOL_AS_NAME_VALUE, ENUM_POOL_AS_NAME_STRING, ENUM_POOL_AS_NAME_VALUE_STRING) \
+    } e##_POOL = \
+    { \
+        e(ENUM_POOL_INIT_AS_NAME, ENUM_POOL_INIT_AS_NAME_VALUE, ENUM_POOL_INIT_AS_NAME_STRING, ENUM_POOL_INIT_AS_NAME_VALUE_STRING) \
+    }; \
+    \
+    static const enum e e##_IMPL[] = \
+    { \
+        e(ENUM_POOL_VALUE, ENUM_POOL_VALUE, ENUM_POOL_VALUE, ENUM_POOL_VALUE) \
+    }; \
+    \
+    static inline enum e e##_ValueAt(size_t idx) \
+    { \
+        return e##_IMPL[idx]; \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) \
+    { \
+        /* a fixed block-scope name lets the X-Macros below refer to the pool type */ \
+        typedef struct e##_Pool Enum_Pool_t; \
+        static const offset_t offsets[] = \
+        { \
+            e(ENUM_POOL_OFFSET, ENUM_POOL_OFFSET, ENUM_POOL_OFFSET, ENUM_POOL_OFFSET) \
+        }; \
+        \
+        ENUM_STATIC_ASSERT(sizeof(Enum_Pool_t) - 1 <= (offset_t) -1); \
+        \
+        return (char const*) &e##_POOL + offsets[idx]; \
+    } \
+    \
+    static inline size_t e##_NameLengthAt(size_t idx) \
+    { \
+        typedef struct e##_Pool Enum_Pool_t; \
+        static const offset_t lengths[] = \
+        { \
+            e(ENUM_POOL_LENGTH, ENUM_POOL_LENGTH, ENUM_POOL_LENGTH, ENUM_POOL_LENGTH) \
+        }; \
+        \
+        return lengths[idx]; \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) /* takes the closing semi-colon */
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal X-Macro which emits a pool member sized for @p "name".
+ *
+ * @param name An enum element name
+ *
+ * @code
+ * ENUM_POOL_AS_NAME(TRIANGLE) => char TRIANGLE[sizeof("TRIANGLE")];
+ * @endcode
+ */
+#define ENUM_POOL_AS_NAME(name) char name[sizeof(#name)];
+
+/**
+ * Internal X-Macro which emits a pool member sized for @p "name".
+ *
+ * @param name An enum element name
+ * @param unused_value Unused constant integer expression.
+ *
+ * @code
+ * ENUM_POOL_AS_NAME_VALUE(TRIANGLE, 3) => char TRIANGLE[sizeof("TRIANGLE")];
+ * @endcode
+ */
+#define ENUM_POOL_AS_NAME_VALUE(name, unused_value) char name[sizeof(#name)];
+
+/**
+ * Internal X-Macro which emits a pool member sized for @p string.
+ *
+ * @param name An enum element name
+ * @param string Descriptive string literal assigned to the enum element name
+ *
+ * @code
+ * ENUM_POOL_AS_NAME_STRING(TRIANGLE, "Sides of a Triangle")
+ *      => char TRIANGLE[sizeof("Sides of a Triangle")];
+ * @endcode
+ */
+#define ENUM_POOL_AS_NAME_STRING(name, string) char name[sizeof(string)];
+
+/**
+ * Internal X-Macro which emits a pool member sized for @p string.
+ *
+ * @param name An enum element name
+ * @param unused_value Unused constant integer expression.
+ * @param string Descriptive string literal assigned to the enum element name
+ *
+ * @code
+ * ENUM_POOL_AS_NAME_VALUE_STRING(TRIANGLE, 3, "Sides of a Triangle")
+ *      => char TRIANGLE[sizeof("Sides of a Triangle")];
+ * @endcode
+ */
+#define ENUM_POOL_AS_NAME_VALUE_STRING(name, unused_value, string) char name[sizeof(string)];
+
+/**
+ * Internal X-Macro which emits a pool member initializer @p "name".
+ *
+ * @param name An enum element name
+ *
+ * @code
+ * ENUM_POOL_INIT_AS_NAME(TRIANGLE) => "TRIANGLE",
+ * @endcode
+ */
+#define ENUM_POOL_INIT_AS_NAME(name) #name,
+
+/**
+ * Internal X-Macro which emits a pool member initializer @p "name".
+ *
+ * @param name An enum element name
+ * @param unused_value Unused constant integer expression.
+ *
+ * @code
+ * ENUM_POOL_INIT_AS_NAME_VALUE(TRIANGLE, 3) => "TRIANGLE",
+ * @endcode
+ */
+#define ENUM_POOL_INIT_AS_NAME_VALUE(name, unused_value) #name,
+
+/**
+ * Internal X-Macro which emits a pool member initializer @p string.
+ *
+ * @param name An enum element name
+ * @param string Descriptive string literal assigned to the enum element name
+ *
+ * @code
+ * ENUM_POOL_INIT_AS_NAME_STRING(TRIANGLE, "Sides of a Triangle")
+ *      => "Sides of a Triangle",
+ * @endcode
+ */
+#define ENUM_POOL_INIT_AS_NAME_STRING(name, string) string,
+
+/**
+ * Internal X-Macro which emits a pool member initializer @p string.
+ *
+ * @param name An enum element name
+ * @param unused_value Unused constant integer expression.
+ * @param string Descriptive string literal assigned to the enum element name
+ *
+ * @code
+ * ENUM_POOL_INIT_AS_NAME_VALUE_STRING(TRIANGLE, 3, "Sides of a Triangle")
+ *      => "Sides of a Triangle",
+ * @endcode
+ */
+#define ENUM_POOL_INIT_AS_NAME_VALUE_STRING(name, unused_value, string) string,
+
+/**
+ * Internal X-Macro which emits a value array initializer <tt>(name),</tt>.
+ *
+ * @code
+ * ENUM_POOL_VALUE(TRIANGLE, 3, "Sides of a Triangle") => (TRIANGLE),
+ * @endcode
+ */
+#define ENUM_POOL_VALUE(...) (ENUM_NAME_OF(__VA_ARGS__)),
+
+/**
+ * Internal X-Macro which emits the offset of the element's name in the pool.
+ *
+ * @pre @p Enum_Pool_t names the pool struct in the current scope.
+ *
+ * @code
+ * ENUM_POOL_OFFSET(TRIANGLE, 3, "Sides of a Triangle")
+ *      => offsetof(Enum_Pool_t, TRIANGLE),
+ * @endcode
+ */
+#define ENUM_POOL_OFFSET(...) offsetof(Enum_Pool_t, ENUM_NAME_OF(__VA_ARGS__)),
+
+/**
+ * Internal X-Macro which emits a name length array initializer, the size of
+ * the element's pool member less its NUL.
+ *
+ * @pre @p Enum_Pool_t names the pool struct in the current scope.
+ */
+#define ENUM_POOL_LENGTH(...) sizeof(((Enum_Pool_t*) 0)->ENUM_NAME_OF(__VA_ARGS__)) - 1,
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_POOL_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
@@ -0,0 +1,391 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Common-prefix compression of element names.
+ *
+ * Elements are usually named after their enum, as @p SHAPE_TRIANGLE,
+ * @p SHAPE_SQUARE, ..., so every name stringified into a table repeats the
+ * same prefix. In a large enum the copies add up to a good part of its
+ * read-only data.
+ *
+ * @ref ENUM_PREFIX_LIST writes a C-Enum list from a list of suffixes and a
+ * prefix, declared once:
+ *
+ * @code
+ * #define SHAPE_SUFFIXES(_, _V, _S, _VS) \
+ *     _(TRIANGLE) \
+ *     _V(SQUARE, 5) \
+ *     _S(PENTAGON, "Five sides") \
+ *
+ * #define SHAPE(_, _V, _S, _VS) ENUM_PREFIX_LIST(SHAPE_, SHAPE_SUFFIXES, _, _V, _S, _VS)
+ * @endcode
+ *
+ * @p SHAPE is an ordinary C-Enum list of @p SHAPE_TRIANGLE, @p SHAPE_SQUARE
+ * and @p SHAPE_PENTAGON, which works with every C-Enum macro.
+ * @ref ENUM_IMPL_PREFIX is a table layout which stores the prefix once and
+ * each suffix in a pool. With it, ToString functions return the short name,
+ * @ref ENUM_DEFINE_TOSTRING_FULL assembles the full name into a caller
+ * buffer, and @ref ENUM_DEFINE_FROMSTRING_PREFIX accepts either form.
+ *
+ */
+#ifndef ENUM_PREFIX_H
+#define ENUM_PREFIX_H
+
+#include "enum.h"
+
+/**
+ * Expands the suffix list @p names as the C-Enum list whose element names
+ * are @p prefix pasted onto each suffix, with the X-Macros @p _, @p _V,
+ * @p _S and @p _VS. Values and descriptive strings pass through unchanged.
+ *
+ * @param prefix Prefix of every element name, such as @p SHAPE_.
+ * @param names  A C-Enum list of the suffixes. A suffix may be a number,
+ *               as in @p HTTP_ and @p 404.
+ * @param _      X-Macro for @p name elements.
+ * @param _V     X-Macro for @p (name, value) elements.
+ * @param _S     X-Macro for @p (name, string) elements.
+ * @param _VS    X-Macro for @p (name, value, string) elements.
+ *
+ * @code
+ * #define SHAPE(_, _V, _S, _VS) ENUM_PREFIX_LIST(SHAPE_, SHAPE_SUFFIXES, _, _V, _S, _VS)
+ *
+ * SHAPE(ENUM_AS_NAME, ...) => ENUM_AS_NAME(SHAPE_TRIANGLE) ENUM_AS_NAME_VALUE(SHAPE_SQUARE, 5) ...
+ * @endcode
+ */
+#define ENUM_PREFIX_LIST(prefix, names, _, _V, _S, _VS) \
+    ENUM_PREFIX_EVAL(names(ENUM_PREFIX_BIND(ENUM_PREFIX_CALL, _, prefix), \
+                           ENUM_PREFIX_BIND(ENUM_PREFIX_CALL_1, _V, prefix), \
+                           ENUM_PREFIX_BIND(ENUM_PREFIX_CALL_1, _S, prefix), \
+                           ENUM_PREFIX_BIND(ENUM_PREFIX_CALL_2, _VS, prefix)))
+
+/**
+ * Allocates a prefix-compressed data table for the enum @p e.
+ *
+ * A drop-in alternative to @ref ENUM_IMPL. It emits @p e_PREFIX, the prefix
+ * as a string, @p e_POOL, a constant struct holding each suffix in place,
+ * as @ref ENUM_IMPL_POOL does, @p e_IMPL, a static constant array of
+ * values, and the accessors @p e_ValueAt, @p e_NameAt, @p e_NameLengthAt
+ * and @p e_PrefixLengthAt.
+ *
+ * @p e_NameAt returns the short name: the suffix, or the descriptive string
+ * of an element with one. @p e_PrefixLengthAt returns the length of
+ * @p e_PREFIX for a suffix and zero for a descriptive string, so the full
+ * name is that many characters of @p e_PREFIX followed by @p e_NameAt.
+ *
+ * Each element saves <tt>sizeof(e_PREFIX) - 1</tt> bytes of read-only data
+ * over @ref ENUM_IMPL_POOL, and the table needs no relocations.
+ *
+ * @param e      A C-Enum list, such as one from @ref ENUM_PREFIX_LIST.
+ * @param prefix Prefix of every element name.
+ * @param names  The list of suffixes which, with @p prefix, names the
+ *               elements of @p e.
+ *
+ * @note This is a required pre-declaration for all ENUM_DEFINE_* macros, in
+ *       place of @ref ENUM_IMPL.
+ * @note A @p prefix or @p names which does not match the elements of @p e
+ *       names no enumerator, so is rejected at compile time.
+ *
+ * @code
+ * ENUM(SHAPE);
+ * ENUM_IMPL_PREFIX(SHAPE, SHAPE_, SHAPE_SUFFIXES);
+ * ENUM_DEFINE_TOSTRING(SHAPE, Shape_ToString)
+ *
+ * printf("%s\n", Shape_ToString(SHAPE_SQUARE)); // SQUARE
+ * @endcode
+ *
+ */
+#define ENUM_IMPL_PREFIX(e, prefix, names) \
+    typedef ptrdiff_t e##_Iterator_t; \
+    static const char e##_PREFIX[] = #prefix; \
+    \
+    static const struct e##_Pool \
+    { \
+        names(ENUM_PREFIX_AS_NAME, ENUM_PREFIX_AS_NAME_VALUE, ENUM_PREFIX_AS_NAME_STRING, ENUM_PREFIX_AS_NAME_VALUE_STRING) \
+    } e##_POOL = \
+    { \
+        names(ENUM_PREFIX_INIT_AS_NAME, ENUM_PREFIX_INIT_AS_NAME_VALUE, ENUM_PREFIX_INIT_AS_NAME_STRING, ENUM_PREFIX_INIT_AS_NAME_VALUE_STRING) \
+    }; \
+    \
+    static const enum e e##_IMPL[] = \
+    { \
+        ENUM_PREFIX_LIST(prefix, names, ENUM_PREFIX_VALUE, ENUM_PREFIX_VALUE, ENUM_PREFIX_VALUE, ENUM_PREFIX_VALUE) \
+    }; \
+    \
+    static inline enum e e##_ValueAt(size_t idx) \
+    { \
+        return e##_IMPL[idx]; \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) \
+    { \
+        /* a fixed block-scope name lets the X-Macros below refer to the pool type */ \
+        typedef struct e##_Pool Enum_Pool_t; \
+        static const uint32_t offsets[] = \
+        { \
+            names(ENUM_PREFIX_OFFSET, ENUM_PREFIX_OFFSET, ENUM_PREFIX_OFFSET, ENUM_PREFIX_OFFSET) \
+        }; \
+        \
+        return (char const*) &e##_POOL + offsets[idx]; \
+    } \
+    \
+    static inline size_t e##_NameLengthAt(size_t idx) \
+    { \
+        typedef struct e##_Pool Enum_Pool_t; \
+        static const uint32_t lengths[] = \
+        { \
+            names(ENUM_PREFIX_LENGTH, ENUM_PREFIX_LENGTH, ENUM_PREFIX_LENGTH, ENUM_PREFIX_LENGTH) \
+        }; \
+        \
+        return lengths[idx]; \
+    } \
+    \
+    static inline size_t e##_PrefixLengthAt(size_t idx) \
+    { \
+        static const unsigned char prefixed[] = \
+        { \
+            names(ENUM_PREFIX_ONE, ENUM_PREFIX_ONE, ENUM_PREFIX_ZERO, ENUM_PREFIX_ZERO) \
+        }; \
+        \
+        return prefixed[idx] ? sizeof(e##_PREFIX) - 1 : 0; \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) /* takes the closing semi-colon */
+
+/**
+ * Emit a full-name ToString function declaration @p fname for the enum
+ * @p e.
+ *
+ * @param e An enum name.
+ * @param fname Full-name ToString function name.
+ */
+#define ENUM_DECLARE_TOSTRING_FULL(e, fname) \
+    size_t fname(enum e literal, char* buf, size_t size)
+
+/**
+ * Emit a full-name ToString function definition @p fname for the enum
+ * @p e.
+ *
+ * Writes the full name of @p literal's element, the prefix followed by its
+ * suffix, or its descriptive string, or @ref ENUM_UNKNOWN_STRING, into
+ * @p buf. As with @p snprintf, at most @p size - 1 characters are written,
+ * the result is always NUL terminated when @p size is non-zero, and the
+ * return value is the length of the untruncated name.
+ *
+ * @param e An enum name.
+ * @param fname of full-name ToString function.
+ * @param indexof An IndexOf function for @p e, such as one from
+ *                @ref ENUM_DEFINE_INDEXOF.
+ *
+ * @pre @ref ENUM_IMPL_PREFIX declaration must be visible in the current
+ *      context.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_DEFINE_INDEXOF(SHAPE, Shape_IndexOf)
+ * ENUM_DEFINE_TOSTRING_FULL(SHAPE, Shape_ToFullString, Shape_IndexOf)
+ *
+ * char buf[32];
+ * size_t len = Shape_ToFullString(SHAPE_SQUARE, buf, sizeof(buf));
+ * // buf = "SHAPE_SQUARE", len = 12
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_TOSTRING_FULL(e, fname, indexof) \
+    ENUM_DECLARE_TOSTRING_FULL(e, fname) \
+    { \
+        e##_Iterator_t idx = indexof(literal); \
+        size_t length = 0; \
+        \
+        if (idx == ENUM_INDEX_UNKNOWN) \
+        { \
+            length = Enum_Append(buf, size, 0, ENUM_UNKNOWN_STRING, sizeof(ENUM_UNKNOWN_STRING) - 1); \
+        } \
+        else \
+        { \
+            length = Enum_Append(buf, size, 0, e##_PREFIX, e##_PrefixLengthAt((size_t) idx)); \
+            length += Enum_Append(buf, size, length, e##_NameAt((size_t) idx), e##_NameLengthAt((size_t) idx)); \
+        } \
+        \
+        if (size > 0) \
+        { \
+            buf[length < size ? length : size - 1] = '\0'; \
+        } \
+        \
+        return length; \
+    } \
+
+/**
+ * Emit a FromString function definition @p fname for the enum @p e which
+ * accepts full names as well as short ones.
+ *
+ * The @p len characters at @p str are looked up with their prefix removed,
+ * if they start with it, and then as they are, so both @p "SHAPE_SQUARE"
+ * and @p "SQUARE" map to @p SHAPE_SQUARE. Parsers of logs written with
+ * either form keep working.
+ *
+ * @param e An enum name.
+ * @param fname of FromString function.
+ * @param fromstring A FromString function of short names for @p e, such as
+ *                   one from @ref ENUM_DEFINE_FROMSTRING.
+ *
+ * @return @ref ENUM_OK, or @ref ENUM_E_UNKNOWN if neither form names an
+ *         element, in which case @p *literal is unchanged.
+ *
+ * @pre @ref ENUM_IMPL_PREFIX declaration must be visible in the current
+ *      context.
+ *
+ * @note No closing semi-colon.
+ * @note Declare with @ref ENUM_DECLARE_FROMSTRING.
+ * @note The prefix is removed from a descriptive string too, so
+ *       @p "SHAPE_Five sides" maps to @p SHAPE_PENTAGON.
+ *
+ * @code
+ * ENUM_DEFINE_FROMSTRING(SHAPE, Shape_FromShortString)
+ * ENUM_DEFINE_FROMSTRING_PREFIX(SHAPE, Shape_FromString, Shape_FromShortString)
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_FROMSTRING_PREFIX(e, fname, fromstring) \
+    ENUM_DECLARE_FROMSTRING(e, fname) \
+    { \
+        if (len > sizeof(e##_PREFIX) - 1 \
+            && memcmp(str, e##_PREFIX, sizeof(e##_PREFIX) - 1) == 0 \
+            && fromstring(str + sizeof(e##_PREFIX) - 1, len - (sizeof(e##_PREFIX) - 1), literal) == ENUM_OK) \
+        { \
+            return ENUM_OK; \
+        } \
+        \
+        return fromstring(str, len, literal); \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal macros which delay an X-Macro call by one scan.
+ *
+ * @ref ENUM_PREFIX_BIND hands the suffix list, in place of an X-Macro, the
+ * tokens <tt>call ( link, prefix, ENUM_PREFIX_UNWRAP</tt>, with the
+ * parenthesis not yet expanded. The list appends the element's
+ * <tt>(name, ...)</tt>, which @ref ENUM_PREFIX_UNWRAP turns into
+ * <tt>name, ...)</tt>, closing the call, and @ref ENUM_PREFIX_EVAL rescans
+ * the result, so each element becomes <tt>link(prefix##name, ...)</tt>.
+ */
+#define ENUM_PREFIX_EMPTY()
+#define ENUM_PREFIX_LPAREN() (
+#define ENUM_PREFIX_UNWRAP(...) __VA_ARGS__)
+#define ENUM_PREFIX_EVAL(...) __VA_ARGS__
+#define ENUM_PREFIX_BIND(call, link, prefix) \
+    call ENUM_PREFIX_LPAREN ENUM_PREFIX_EMPTY() () link, prefix, ENUM_PREFIX_UNWRAP
+
+/**
+ * Internal macros which call the X-Macro @p link with the full name of an
+ * element of each tuple form.
+ */
+#define ENUM_PREFIX_CALL(link, prefix, name) link(prefix##name)
+#define ENUM_PREFIX_CALL_1(link, prefix, name, a) link(prefix##name, a)
+#define ENUM_PREFIX_CALL_2(link, prefix, name, a, b) link(prefix##name, a, b)
+
+/**
+ * Internal X-Macro which emits a value array initializer <tt>(name),</tt>.
+ */
+#define ENUM_PREFIX_VALUE(...) (ENUM_NAME_OF(__VA_ARGS__)),
+
+/**
+ * Internal name of the pool member of the suffix @p name, which may be a
+ * number.
+ *
+ * @code
+ * ENUM_PREFIX_MEMBER(404) => enum_404
+ * @endcode
+ */
+#define ENUM_PREFIX_MEMBER(name) ENUM_PREFIX_MEMBER_I(name)
+#define ENUM_PREFIX_MEMBER_I(name) enum_##name
+
+/**
+ * Internal X-Macro which emits a pool member sized for @p "name".
+ *
+ * @code
+ * ENUM_PREFIX_AS_NAME(TRIANGLE) => char enum_TRIANGLE[sizeof("TRIANGLE")];
+ * @endcode
+ */
+#define ENUM_PREFIX_AS_NAME(name) char ENUM_PREFIX_MEMBER(name)[sizeof(#name)];
+
+/**
+ * Internal X-Macro which emits a pool member sized for @p "name".
+ */
+#define ENUM_PREFIX_AS_NAME_VALUE(name, unused_value) char ENUM_PREFIX_MEMBER(name)[sizeof(#name)];
+
+/**
+ * Internal X-Macro which emits a pool member sized for @p string.
+ */
+#define ENUM_PREFIX_AS_NAME_STRING(name, string) char ENUM_PREFIX_MEMBER(name)[sizeof(string)];
+
+/**
+ * Internal X-Macro which emits a pool member sized for @p string.
+ */
+#define ENUM_PREFIX_AS_NAME_VALUE_STRING(name, unused_value, string) char ENUM_PREFIX_MEMBER(name)[sizeof(string)];
+
+/**
+ * Internal X-Macro which emits a pool member initializer @p "name".
+ */
+#define ENUM_PREFIX_INIT_AS_NAME(name) #name,
+
+/**
+ * Internal X-Macro which emits a pool member initializer @p "name".
+ */
+#define ENUM_PREFIX_INIT_AS_NAME_VALUE(name, unused_value) #name,
+
+/**
+ * Internal X-Macro which emits a pool member initializer @p string.
+ */
+#define ENUM_PREFIX_INIT_AS_NAME_STRING(name, string) string,
+
+/**
+ * Internal X-Macro which emits a pool member initializer @p string.
+ */
+#define ENUM_PREFIX_INIT_AS_NAME_VALUE_STRING(name, unused_value, string) string,
+
+/**
+ * Internal X-Macro which emits the offset of the element's short name in
+ * the pool.
+ *
+ * @pre @p Enum_Pool_t names the pool struct in the current scope.
+ */
+#define ENUM_PREFIX_OFFSET(...) offsetof(Enum_Pool_t, ENUM_PREFIX_MEMBER(ENUM_NAME_OF(__VA_ARGS__))),
+
+/**
+ * Internal X-Macro which emits the length of the element's short name in
+ * the pool.
+ *
+ * @pre @p Enum_Pool_t names the pool struct in the current scope.
+ */
+#define ENUM_PREFIX_LENGTH(...) sizeof(((Enum_Pool_t*) 0)->ENUM_PREFIX_MEMBER(ENUM_NAME_OF(__VA_ARGS__))) - 1,
+
+/**
+ * Internal X-Macros which emit whether the element's full name has the
+ * prefix: one for a suffix, zero for a descriptive string.
+ */
+#define ENUM_PREFIX_ONE(...) 1,
+#define ENUM_PREFIX_ZERO(...) 0,
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_PREFIX_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
@@ -0,0 +1,207 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Bitset-backed sets of enum elements.
+ *
+ * A set holds one bit per element of the enum, at the element's iterator
+ * index, in as many 64-bit words as @ref ENUM_COUNT needs. Values are turned
+ * into bit indices by an IndexOf function, so sets of sparse or negative
+ * values are as small as sets of contiguous ones.
+ *
+ * Union and intersection work a word at a time, the member count is a
+ * popcount per word, and iteration skips to the next member with a
+ * count-trailing-zeros. Iteration yields iterators, which map to values
+ * through the same @p tovalue function as @ref ENUM_DEFINE_ITERATOR.
+ *
+ * Elements which share a value with an earlier element share its bit.
+ *
+ */
+#ifndef ENUM_SET_H
+#define ENUM_SET_H
+
+#include "enum.h"
+
+/**
+ * Integer constant expression for the number of 64-bit words in a set of
+ * the enum @p e.
+ *
+ * @param e A C-Enum list.
+ */
+#define ENUM_SET_WORDS(e) ((ENUM_COUNT(e) + 63) / 64)
+
+/**
+ * Emit the set type @p set_t and its function declarations for the enum
+ * @p e.
+ *
+ * @param e   C-Enum Name.
+ * @param set Set name, which prefixes the type and functions.
+ *
+ * @note Needs only @ref ENUM, so may be used in headers. Iterators are
+ *       declared as @p ptrdiff_t, the type of @p e_Iterator_t.
+ *
+ * @code
+ * ENUM_DECLARE_SET(ERROR, ErrorSet);
+ *
+ * ErrorSet_t seen = {{0}};
+ * @endcode
+ */
+#define ENUM_DECLARE_SET(e, set) \
+    typedef struct \
+    { \
+        uint64_t words[ENUM_SET_WORDS(e)]; \
+    } set##_t; \
+    \
+    enum ENUM_STATUS set##_Insert(set##_t* self, enum e literal); \
+    enum ENUM_STATUS set##_Erase(set##_t* self, enum e literal); \
+    int set##_Contains(set##_t const* self, enum e literal); \
+    void set##_Union(set##_t* self, set##_t const* other); \
+    void set##_Intersection(set##_t* self, set##_t const* other); \
+    size_t set##_Count(set##_t const* self); \
+    ptrdiff_t set##_Next(set##_t const* self, ptrdiff_t iter) \
+
+/**
+ * Emit the function definitions of the set @p set for the enum @p e.
+ *
+ * - @p set_Insert and @p set_Erase add and remove @p literal, and return
+ *   @ref ENUM_OK, or @ref ENUM_E_UNKNOWN if @p literal is not an element.
+ * - @p set_Contains returns non-zero if @p literal is a member.
+ * - @p set_Union and @p set_Intersection update @p self in place.
+ * - @p set_Count returns the number of members.
+ * - @p set_Next returns the iterator of the first member after @p iter, or
+ *   @ref ENUM_INDEX_UNKNOWN if there is none. Pass @ref ENUM_INDEX_UNKNOWN
+ *   to find the first member.
+ *
+ * @param e       An enum name.
+ * @param set     Set name, as passed to @ref ENUM_DECLARE_SET.
+ * @param indexof An IndexOf function for @p e, such as one from
+ *                @ref ENUM_DEFINE_INDEXOF.
+ *
+ * @pre @ref ENUM_DECLARE_SET for @p set must be visible in the current
+ *      context.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_IMPL(ERROR);
+ * ENUM_DEFINE_INDEXOF(ERROR, Error_IndexOf)
+ * ENUM_DEFINE_ITERATOR(ERROR, Error_IteratorBegin, Error_IteratorEnd, Error_IteratorToValue)
+ * ENUM_DEFINE_SET(ERROR, ErrorSet, Error_IndexOf)
+ *
+ * ERROR_Iterator_t iter;
+ *
+ * ErrorSet_Insert(&seen, ERROR_TIMEOUT);
+ *
+ * for (iter = ErrorSet_Next(&seen, ENUM_INDEX_UNKNOWN);
+ *      iter != ENUM_INDEX_UNKNOWN;
+ *      iter = ErrorSet_Next(&seen, iter))
+ * {
+ *     printf("%s\n", Error_ToString(Error_IteratorToValue(iter)));
+ * }
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_SET(e, set, indexof) \
+    enum ENUM_STATUS set##_Insert(set##_t* self, enum e literal) \
+    { \
+        e##_Iterator_t idx = indexof(literal); \
+        \
+        if (idx == ENUM_INDEX_UNKNOWN) \
+        { \
+            return ENUM_E_UNKNOWN; \
+        } \
+        \
+        self->words[idx / 64] |= (uint64_t) 1 << (idx % 64); \
+        return ENUM_OK; \
+    } \
+    \
+    enum ENUM_STATUS set##_Erase(set##_t* self, enum e literal) \
+    { \
+        e##_Iterator_t idx = indexof(literal); \
+        \
+        if (idx == ENUM_INDEX_UNKNOWN) \
+        { \
+            return ENUM_E_UNKNOWN; \
+        } \
+        \
+        self->words[idx / 64] &= ~((uint64_t) 1 << (idx % 64)); \
+        return ENUM_OK; \
+    } \
+    \
+    int set##_Contains(set##_t const* self, enum e literal) \
+    { \
+        e##_Iterator_t idx = indexof(literal); \
+        \
+        return idx != ENUM_INDEX_UNKNOWN \
+               && (self->words[idx / 64] >> (idx % 64) & 1) != 0; \
+    } \
+    \
+    void set##_Union(set##_t* self, set##_t const* other) \
+    { \
+        size_t word = 0; \
+        \
+        for (word = 0; word < ENUM_SET_WORDS(e); ++word) \
+        { \
+            self->words[word] |= other->words[word]; \
+        } \
+    } \
+    \
+    void set##_Intersection(set##_t* self, set##_t const* other) \
+    { \
+        size_t word = 0; \
+        \
+        for (word = 0; word < ENUM_SET_WORDS(e); ++word) \
+        { \
+            self->words[word] &= other->words[word]; \
+        } \
+    } \
+    \
+    size_t set##_Count(set##_t const* self) \
+    { \
+        size_t count = 0; \
+        size_t word = 0; \
+        \
+        for (word = 0; word < ENUM_SET_WORDS(e); ++word) \
+        { \
+            count += Enum_Popcount64(self->words[word]); \
+        } \
+        \
+        return count; \
+    } \
+    \
+    ptrdiff_t set##_Next(set##_t const* self, ptrdiff_t iter) \
+    { \
+        size_t idx = (size_t) (iter + 1); \
+        size_t word = idx / 64; \
+        uint64_t bits = 0; \
+        \
+        ENUM_STATIC_ASSERT(ENUM_COUNT(e) == sizeof(e##_IMPL)/sizeof(*e##_IMPL)); \
+        \
+        if (word >= ENUM_SET_WORDS(e)) \
+        { \
+            return ENUM_INDEX_UNKNOWN; \
+        } \
+        \
+        bits = self->words[word] & (~(uint64_t) 0 << (idx % 64)); \
+        while (bits == 0) \
+        { \
+            if (++word >= ENUM_SET_WORDS(e)) \
+            { \
+                return ENUM_INDEX_UNKNOWN; \
+            } \
+            \
+            bits = self->words[word]; \
+        } \
+        \
+        return (ptrdiff_t) (word * 64 + Enum_Ctz64(bits)); \
+    } \
+
+#endif /* ENUM_SET_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
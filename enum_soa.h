@@ -0,0 +1,305 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Structure-of-arrays table layout with a vectorised value search.
+ *
+ * The (value, "name") entries of @ref ENUM_IMPL interleave values with name
+ * pointers, so a search for a value reads four times as many bytes as it
+ * compares. @ref ENUM_IMPL_SOA keeps the values in one contiguous array and
+ * the names in another, and @ref ENUM_DEFINE_TOSTRING_SOA searches the value
+ * array with SSE2 or AVX2 compares of four or eight values at a time.
+ *
+ * The search kernel is chosen at compile time: AVX2 if @p __AVX2__ is
+ * defined, else SSE2 if @p __SSE2__ is defined, else a scalar loop. Define
+ * @p ENUM_NO_SIMD to force the scalar loop.
+ *
+ * The layout emits the same @p e_Iterator_t, @p e_IMPL count and
+ * @p e_ValueAt / @p e_NameAt / @p e_NameLengthAt accessors as
+ * @ref ENUM_IMPL, so all other ENUM_DEFINE_* functions work with it
+ * unchanged.
+ *
+ */
+#ifndef ENUM_SOA_H
+#define ENUM_SOA_H
+
+#include "enum.h"
+
+#if !defined(ENUM_NO_SIMD) && (defined(__AVX2__) || defined(__SSE2__))
+#include <immintrin.h>
+#endif
+
+/**
+ * Allocates a structure-of-arrays data table for the enum @p e.
+ *
+ * A drop-in alternative to @ref ENUM_IMPL. It emits @p e_IMPL, a static
+ * constant array of values, @p e_NAMES, a parallel array of names, and the
+ * @p e_ValueAt, @p e_NameAt and @p e_NameLengthAt accessors.
+ *
+ * @param e A C-Enum list. Descriptive strings must be string literals,
+ *          whose lengths are taken at compile time.
+ *
+ * @note This is a required pre-declaration for all ENUM_DEFINE_* macros, in
+ *       place of @ref ENUM_IMPL.
+ *
+ * @code
+ * ENUM_IMPL_SOA(ERROR);
+ * ENUM_DEFINE_TOSTRING_SOA(ERROR, Error_ToString)
+ * @endcode
+ *
+ */
+#define ENUM_IMPL_SOA(e) \
+    typedef ptrdiff_t e##_Iterator_t; \
+    static const enum e e##_IMPL[] = \
+    { \
+        e(ENUM_SOA_VALUE, ENUM_SOA_VALUE, ENUM_SOA_VALUE, ENUM_SOA_VALUE) \
+    }; \
+    \
+    static const char* const e##_NAMES[] = \
+    { \
+        e(ENUM_SOA_AS_NAME, ENUM_SOA_AS_NAME_VALUE, ENUM_SOA_AS_NAME_STRING, ENUM_SOA_AS_NAME_VALUE_STRING) \
+    }; \
+    \
+    static inline enum e e##_ValueAt(size_t idx) \
+    { \
+        return e##_IMPL[idx]; \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) \
+    { \
+        return e##_NAMES[idx]; \
+    } \
+    \
+    static inline size_t e##_NameLengthAt(size_t idx) \
+    { \
+        static const uint32_t lengths[] = \
+        { \
+            e(ENUM_SOA_LENGTH_AS_NAME, ENUM_SOA_LENGTH_AS_NAME_VALUE, ENUM_SOA_LENGTH_AS_NAME_STRING, ENUM_SOA_LENGTH_AS_NAME_VALUE_STRING) \
+        }; \
+        \
+        return lengths[idx]; \
+    } \
+    \
+    static inline char const* e##_NameAt(size_t idx) /* takes the closing semi-colon */
+
+/**
+ * Emit a vectorised ToString function definition @p fname for the enum @p e.
+ *
+ * Returns the same strings as @ref ENUM_DEFINE_TOSTRING.
+ *
+ * @param e An enum name.
+ * @param fname of ToString function.
+ *
+ * @pre A table layout whose @p e_IMPL is an array of values, that is
+ *      @ref ENUM_IMPL_SOA, @ref ENUM_IMPL_POOL, @ref ENUM_IMPL_HOT_COLD or
+ *      @ref ENUM_IMPL_PREFIX, must be visible in the current context.
+ *      Others are rejected at compile time.
+ *
+ * @note No closing semi-colon.
+ * @note Declare with @ref ENUM_DECLARE_TOSTRING.
+ *
+ * @code
+ * ENUM_IMPL_SOA(ERROR);
+ * ENUM_DEFINE_TOSTRING_SOA(ERROR, Error_ToString)
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_TOSTRING_SOA(e, fname) \
+    ENUM_DECLARE_TOSTRING(e, fname) \
+    { \
+        size_t idx = ENUM_SOA_FIND(e, literal); \
+        \
+        ENUM_STATIC_ASSERT(sizeof(enum e) == sizeof(int32_t)); \
+        \
+        if (idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL)) \
+        { \
+            return e##_NameAt(idx); \
+        } \
+        \
+        return ENUM_UNKNOWN_STRING; \
+    } \
+
+/**
+ * Emit a vectorised IndexOf function definition @p fname for the enum @p e.
+ *
+ * @param e An enum name.
+ * @param fname of IndexOf function.
+ *
+ * @pre As for @ref ENUM_DEFINE_TOSTRING_SOA.
+ *
+ * @note No closing semi-colon.
+ * @note Declare with @ref ENUM_DECLARE_INDEXOF.
+ *
+ */
+#define ENUM_DEFINE_INDEXOF_SOA(e, fname) \
+    ENUM_DECLARE_INDEXOF(e, fname) \
+    { \
+        size_t idx = ENUM_SOA_FIND(e, literal); \
+        \
+        ENUM_STATIC_ASSERT(sizeof(enum e) == sizeof(int32_t)); \
+        \
+        if (idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL)) \
+        { \
+            return (e##_Iterator_t) idx; \
+        } \
+        \
+        return ENUM_INDEX_UNKNOWN; \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal X-Macro which emits a value array initializer <tt>(name),</tt>.
+ */
+#define ENUM_SOA_VALUE(...) (ENUM_NAME_OF(__VA_ARGS__)),
+
+/**
+ * Internal X-Macro which emits a name array initializer @p "name".
+ *
+ * @param name An enum element name
+ */
+#define ENUM_SOA_AS_NAME(name) #name,
+
+/**
+ * Internal X-Macro which emits a name array initializer @p "name".
+ *
+ * @param name An enum element name
+ * @param unused_value Unused constant integer expression.
+ */
+#define ENUM_SOA_AS_NAME_VALUE(name, unused_value) #name,
+
+/**
+ * Internal X-Macro which emits a name array initializer @p string.
+ *
+ * @param name An enum element name
+ * @param string Descriptive string assigned to the enum element name
+ */
+#define ENUM_SOA_AS_NAME_STRING(name, string) string,
+
+/**
+ * Internal X-Macro which emits a name array initializer @p string.
+ *
+ * @param name An enum element name
+ * @param unused_value Unused constant integer expression.
+ * @param string Descriptive string assigned to the enum element name
+ */
+#define ENUM_SOA_AS_NAME_VALUE_STRING(name, unused_value, string) string,
+
+/**
+ * Internal X-Macro which emits a name length array initializer.
+ *
+ * @param name An enum element name
+ */
+#define ENUM_SOA_LENGTH_AS_NAME(name) sizeof(#name) - 1,
+
+/**
+ * Internal X-Macro which emits a name length array initializer.
+ *
+ * @param name An enum element name
+ * @param unused_value Unused constant integer expression.
+ */
+#define ENUM_SOA_LENGTH_AS_NAME_VALUE(name, unused_value) sizeof(#name) - 1,
+
+/**
+ * Internal X-Macro which emits a name length array initializer.
+ *
+ * @param name An enum element name
+ * @param string Descriptive string literal assigned to the enum element name
+ */
+#define ENUM_SOA_LENGTH_AS_NAME_STRING(name, string) sizeof("" string) - 1,
+
+/**
+ * Internal X-Macro which emits a name length array initializer.
+ *
+ * @param name An enum element name
+ * @param unused_value Unused constant integer expression.
+ * @param string Descriptive string literal assigned to the enum element name
+ */
+#define ENUM_SOA_LENGTH_AS_NAME_VALUE_STRING(name, unused_value, string) sizeof("" string) - 1,
+
+/**
+ * Internal expression for the index of the first element of @p e with value
+ * @p literal, or the element count if there is none.
+ *
+ * Fails to compile if @p e_IMPL is not an array of bare values, as the
+ * (value, "name") entries of @ref ENUM_IMPL are not, rather than scanning
+ * names as values.
+ *
+ * @pre @p enum e is 32 bits wide, as are all enums whose values are in the
+ *      range of @p int.
+ */
+#define ENUM_SOA_FIND(e, literal) \
+    (ENUM_STATIC_ASSERT(sizeof(*e##_IMPL) == sizeof(int32_t)), \
+     Enum_FindInt32((int32_t const*) e##_IMPL, \
+                    sizeof(e##_IMPL)/sizeof(*e##_IMPL), \
+                    (int32_t) (literal)))
+
+/**
+ * Internal search of the @p count values at @p values for @p key.
+ *
+ * @return The index of the first match, or @p count if there is none.
+ */
+static inline size_t Enum_FindInt32(int32_t const* values, size_t count, int32_t key)
+{
+    size_t idx = 0;
+
+#if !defined(ENUM_NO_SIMD) && defined(__AVX2__)
+    __m256i keys = _mm256_set1_epi32(key);
+
+    for (; idx + 8 <= count; idx += 8)
+    {
+        __m256i block = _mm256_loadu_si256((__m256i const*) (values + idx));
+        unsigned mask = (unsigned) _mm256_movemask_ps(
+                            _mm256_castsi256_ps(_mm256_cmpeq_epi32(block, keys)));
+
+        if (mask)
+        {
+            return idx + Enum_Ctz64(mask);
+        }
+    }
+#elif !defined(ENUM_NO_SIMD) && defined(__SSE2__)
+    __m128i keys = _mm_set1_epi32(key);
+
+    for (; idx + 4 <= count; idx += 4)
+    {
+        __m128i block = _mm_loadu_si128((__m128i const*) (values + idx));
+        unsigned mask = (unsigned) _mm_movemask_ps(
+                            _mm_castsi128_ps(_mm_cmpeq_epi32(block, keys)));
+
+        if (mask)
+        {
+            return idx + Enum_Ctz64(mask);
+        }
+    }
+#endif
+
+    for (; idx < count; ++idx)
+    {
+        if (values[idx] == key)
+        {
+            break;
+        }
+    }
+
+    return idx;
+}
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_SOA_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
@@ -0,0 +1,469 @@
+/**
+ * @addtogroup C-Enum
+ * @{
+ */
+
+/**
+ * @file
+ *
+ * @brief Loose name parsing through a trie of the enum's names.
+ *
+ * Names written by people, as in configuration files, are often spelled
+ * loosely: @p triangle, @p Triangle and @p SHAPE_TRIANGLE may all mean the
+ * element @p SHAPE_TRIANGLE. @ref ENUM_DEFINE_FROMSTRING_TRIE parses such
+ * names in one pass over the input, walking a trie built from the names in
+ * @p e_IMPL. Options, or-ed together, choose the spellings accepted:
+ *
+ * - @ref ENUM_TRIE_FOLD_CASE matches ASCII letters in either case.
+ * - @ref ENUM_TRIE_STRIP_PREFIX also accepts each name without the prefix
+ *   common to all names, up to its last @p '_', such as @p SHAPE_.
+ * - @ref ENUM_TRIE_ABBREVIATE accepts any prefix of one element's names.
+ *
+ * Input which is a prefix of names of elements with different values is
+ * reported as @ref ENUM_E_AMBIGUOUS, whether or not abbreviations are
+ * accepted.
+ *
+ * The trie is a static array of nodes, sized at compile time from the
+ * number of names, so parsing never allocates. Runs of bytes shared by
+ * all names below a node are merged into one edge, and a node's children
+ * are adjacent and sorted, so each byte of input costs a compare, and each
+ * branch a short scan.
+ *
+ */
+#ifndef ENUM_TRIE_H
+#define ENUM_TRIE_H
+
+#include "enum.h"
+
+#include <stdlib.h> // qsort
+
+/**
+ * Option for @ref ENUM_DEFINE_FROMSTRING_TRIE to match ASCII letters in
+ * either case.
+ */
+#define ENUM_TRIE_FOLD_CASE 1
+
+/**
+ * Option for @ref ENUM_DEFINE_FROMSTRING_TRIE to also match names without
+ * their common prefix.
+ */
+#define ENUM_TRIE_STRIP_PREFIX 2
+
+/**
+ * Option for @ref ENUM_DEFINE_FROMSTRING_TRIE to match unambiguous prefixes
+ * of names.
+ */
+#define ENUM_TRIE_ABBREVIATE 4
+
+/**
+ * Emit a trie FromString function definition @p fname for the enum @p e.
+ *
+ * The function maps the @p len characters at @p str, which need not be NUL
+ * terminated, to the value of the element they name under @p options, and
+ * stores it in @p *literal. It has the signature of
+ * @ref ENUM_DECLARE_FROMSTRING.
+ *
+ * An exact match of a name, after case folding, is preferred to an
+ * abbreviation. If folding makes two names equal, the first declared wins.
+ *
+ * The trie is built on load under GCC compatible compilers, otherwise on
+ * the first call, as for @ref ENUM_DEFINE_FROMSTRING.
+ *
+ * @param e An enum name.
+ * @param fname of FromString function.
+ * @param indexof An IndexOf function for @p e, such as one from
+ *                @ref ENUM_DEFINE_INDEXOF, which tells elements sharing a
+ *                value apart from ambiguous ones.
+ * @param options Zero, or an or of @ref ENUM_TRIE_FOLD_CASE,
+ *                @ref ENUM_TRIE_STRIP_PREFIX and @ref ENUM_TRIE_ABBREVIATE.
+ *
+ * @return @ref ENUM_OK, @ref ENUM_E_AMBIGUOUS if @p str is a prefix of the
+ *         names of elements with different values, or @ref ENUM_E_UNKNOWN.
+ *         @p *literal is only written on success.
+ *
+ * @pre @ref ENUM_IMPL declaration must be visible in the current context.
+ *
+ * @note No closing semi-colon.
+ *
+ * @code
+ * ENUM_DEFINE_INDEXOF(SHAPE, Shape_IndexOf)
+ * ENUM_DEFINE_FROMSTRING_TRIE(SHAPE, Shape_Parse, Shape_IndexOf,
+ *                             ENUM_TRIE_FOLD_CASE | ENUM_TRIE_STRIP_PREFIX)
+ *
+ * enum SHAPE shape;
+ * enum ENUM_STATUS status = Shape_Parse("triangle", 8, &shape);
+ * @endcode
+ *
+ */
+#define ENUM_DEFINE_FROMSTRING_TRIE(e, fname, indexof, options) \
+    static struct Enum_TrieNode fname##_TRIE[ENUM_TRIE_SIZE(e, options)]; \
+    static int fname##_TRIE_BUILT; \
+    \
+    ENUM_AT_LOAD static void fname##_TrieInit(void) \
+    { \
+        /* keys are only needed while building, but are too many for the stack */ \
+        static struct Enum_TrieKey keys[ENUM_TRIE_KEYS(e, options)]; \
+        int fold = ((options) & ENUM_TRIE_FOLD_CASE) != 0; \
+        size_t count = sizeof(e##_IMPL)/sizeof(*e##_IMPL); \
+        size_t prefix = count == 0 ? 0 : e##_NameLengthAt(0); \
+        size_t used = 0; \
+        size_t idx = 0; \
+        \
+        for (idx = 1; idx < count; ++idx) \
+        { \
+            prefix = Enum_TrieCommonPrefix(e##_NameAt(0), e##_NameAt(idx), \
+                                           prefix < e##_NameLengthAt(idx) ? prefix : e##_NameLengthAt(idx), \
+                                           fold); \
+        } \
+        \
+        while (prefix > 0 && e##_NameAt(0)[prefix - 1] != '_') \
+        { \
+            --prefix; \
+        } \
+        \
+        for (idx = 0; idx < count; ++idx) \
+        { \
+            /* elements sharing a value are one member of the trie */ \
+            uint32_t member = (uint32_t) indexof(e##_ValueAt(idx)) + 1; \
+            size_t len = e##_NameLengthAt(idx); \
+            \
+            used += Enum_TrieKeyAt(keys + used, e##_NameAt(idx), len, member, idx); \
+            if (((options) & ENUM_TRIE_STRIP_PREFIX) && prefix > 0 && len > prefix) \
+            { \
+                used += Enum_TrieKeyAt(keys + used, e##_NameAt(idx) + prefix, len - prefix, member, idx); \
+            } \
+        } \
+        \
+        Enum_TrieBuild(fname##_TRIE, keys, used, fold); \
+        fname##_TRIE_BUILT = 1; \
+    } \
+    \
+    ENUM_DECLARE_FROMSTRING(e, fname) \
+    { \
+        uint32_t member = 0; \
+        enum ENUM_STATUS status; \
+        \
+        if (!fname##_TRIE_BUILT) \
+        { \
+            fname##_TrieInit(); \
+        } \
+        \
+        status = Enum_TrieFind(fname##_TRIE, str, len, \
+                               ((options) & ENUM_TRIE_FOLD_CASE) != 0, \
+                               ((options) & ENUM_TRIE_ABBREVIATE) != 0, \
+                               &member); \
+        if (status == ENUM_OK) \
+        { \
+            *(literal) = e##_ValueAt(member - 1); \
+        } \
+        \
+        return status; \
+    } \
+
+/*************************************************************************
+ * Internal macros
+ *************************************************************************/
+/**
+ *     @addtogroup Internal
+ *     @{
+ */
+
+/**
+ * Internal number of names of @p e inserted into its trie under @p options:
+ * one per element, or two with the prefix stripped copies.
+ */
+#define ENUM_TRIE_KEYS(e, options) \
+    ((((options) & ENUM_TRIE_STRIP_PREFIX) ? 2 : 1) * ENUM_COUNT(e) + 1)
+
+/**
+ * Internal node count which bounds the trie of @p e under @p options.
+ *
+ * Besides the root, every node ends a name or branches, as single child
+ * runs are merged, and there are fewer branches than names.
+ */
+#define ENUM_TRIE_SIZE(e, options) \
+    (1 + 2 * ENUM_TRIE_KEYS(e, options))
+
+/**
+ * Internal @p below value of a node under which names of more than one
+ * member end.
+ */
+#define ENUM_TRIE_MIXED UINT32_MAX
+
+/**
+ * Internal trie node. Node 0 is the root.
+ *
+ * The edge from the parent is labelled with one or more bytes, as runs of
+ * nodes with one child are merged. The children of a node are contiguous
+ * and sorted by the first byte of their labels, so a lookup scans a few
+ * adjacent nodes per branch.
+ */
+struct Enum_TrieNode
+{
+    char const* label; /**< Bytes on the edge from the parent, in a name. */
+    uint32_t length;   /**< Number of bytes in label. */
+    uint32_t depth;    /**< Length of the path from the root. */
+    uint32_t child;    /**< First child. */
+    uint32_t exact;    /**< Member whose name ends here, plus one, or 0. */
+    uint32_t below;    /**< Member of every name through here, plus one, or ENUM_TRIE_MIXED. */
+    uint16_t children; /**< Number of children. */
+    unsigned char ch;  /**< First byte of label, folded if folding. */
+};
+
+/**
+ * Internal name to insert into a trie.
+ */
+struct Enum_TrieKey
+{
+    char const* str;
+    size_t len;
+    uint32_t member; /**< Member plus one. */
+    uint32_t order;  /**< Element index, which breaks ties. */
+};
+
+/**
+ * Internal ASCII lower-casing of @p ch if @p fold is non-zero.
+ */
+static inline unsigned char Enum_TrieFold(char ch, int fold)
+{
+    unsigned char byte = (unsigned char) ch;
+
+    /* branch free, as letters and digits mix unpredictably in names */
+    return (unsigned char) (byte | (fold && (unsigned char) (byte - 'A') < 26u) << 5);
+}
+
+/**
+ * Internal length of the common prefix of @p a and @p b, up to @p limit.
+ */
+static inline size_t Enum_TrieCommonPrefix(char const* a, char const* b, size_t limit, int fold)
+{
+    size_t len = 0;
+
+    while (len < limit && Enum_TrieFold(a[len], fold) == Enum_TrieFold(b[len], fold))
+    {
+        ++len;
+    }
+
+    return len;
+}
+
+/**
+ * Internal store of a key to @p key.
+ *
+ * @return 1, the number of keys stored.
+ */
+static inline size_t Enum_TrieKeyAt(struct Enum_TrieKey* key,
+                                    char const* str,
+                                    size_t len,
+                                    uint32_t member,
+                                    size_t order)
+{
+    key->str = str;
+    key->len = len;
+    key->member = member;
+    key->order = (uint32_t) order;
+
+    return 1;
+}
+
+/**
+ * Internal @p qsort order of keys, by bytes then by @p order, so of equal
+ * names the first declared sorts first.
+ */
+static inline int Enum_TrieCompareKeys(void const* lhs, void const* rhs, int fold)
+{
+    struct Enum_TrieKey const* a = (struct Enum_TrieKey const*) lhs;
+    struct Enum_TrieKey const* b = (struct Enum_TrieKey const*) rhs;
+    size_t len = Enum_TrieCommonPrefix(a->str, b->str, a->len < b->len ? a->len : b->len, fold);
+
+    if (len < a->len && len < b->len)
+    {
+        return Enum_TrieFold(a->str[len], fold) < Enum_TrieFold(b->str[len], fold) ? -1 : 1;
+    }
+
+    if (a->len != b->len)
+    {
+        return a->len < b->len ? -1 : 1;
+    }
+
+    return a->order < b->order ? -1 : a->order > b->order;
+}
+
+static inline int Enum_TrieCompare(void const* lhs, void const* rhs)
+{
+    return Enum_TrieCompareKeys(lhs, rhs, 0);
+}
+
+static inline int Enum_TrieCompareFolded(void const* lhs, void const* rhs)
+{
+    return Enum_TrieCompareKeys(lhs, rhs, 1);
+}
+
+/**
+ * Internal build of the trie @p nodes from the @p count @p keys, which are
+ * sorted in place.
+ *
+ * Nodes are made in breadth first order. Each node covers the run of
+ * sorted keys which share its path, which is split by the next byte into
+ * runs for its children, made contiguously. A child's label runs on for as
+ * long as all of its keys agree and none ends.
+ */
+static inline void Enum_TrieBuild(struct Enum_TrieNode* nodes,
+                                  struct Enum_TrieKey* keys,
+                                  size_t count,
+                                  int fold)
+{
+    size_t used = 1;
+    size_t node = 0;
+
+    qsort(keys, count, sizeof(*keys), fold ? Enum_TrieCompareFolded : Enum_TrieCompare);
+
+    /* until a node is reached, child and exact hold the bounds of its run */
+    nodes[0].child = 0;
+    nodes[0].exact = (uint32_t) count;
+
+    for (node = 0; node < used; ++node)
+    {
+        size_t lo = nodes[node].child;
+        size_t hi = nodes[node].exact;
+        size_t depth = nodes[node].depth;
+
+        nodes[node].child = (uint32_t) used;
+        nodes[node].exact = 0;
+        nodes[node].children = 0;
+
+        /* the shortest sorts first: a name which ends here */
+        if (lo < hi && keys[lo].len == depth)
+        {
+            nodes[node].exact = keys[lo].member;
+        }
+
+        while (lo < hi && keys[lo].len == depth)
+        {
+            ++lo;
+        }
+
+        while (lo < hi)
+        {
+            unsigned char ch = Enum_TrieFold(keys[lo].str[depth], fold);
+            size_t end = lo;
+            size_t label_end = depth + 1;
+            uint32_t below = keys[lo].member;
+
+            while (end < hi && Enum_TrieFold(keys[end].str[depth], fold) == ch)
+            {
+                below = keys[end].member == below ? below : ENUM_TRIE_MIXED;
+                ++end;
+            }
+
+            /* sorted, so the first and last keys agree only if all do */
+            while (keys[lo].len > label_end
+                   && Enum_TrieFold(keys[lo].str[label_end], fold)
+                      == Enum_TrieFold(keys[end - 1].str[label_end], fold))
+            {
+                ++label_end;
+            }
+
+            nodes[used].label = keys[lo].str + depth;
+            nodes[used].length = (uint32_t) (label_end - depth);
+            nodes[used].depth = (uint32_t) label_end;
+            nodes[used].ch = ch;
+            nodes[used].below = below;
+            nodes[used].child = (uint32_t) lo;
+            nodes[used].exact = (uint32_t) end;
+            ++nodes[node].children;
+            ++used;
+            lo = end;
+        }
+    }
+}
+
+/**
+ * Internal walk of @p nodes over the @p len characters at @p str.
+ *
+ * @return @ref ENUM_OK with the member plus one stored to @p member,
+ *         @ref ENUM_E_AMBIGUOUS or @ref ENUM_E_UNKNOWN.
+ */
+static inline enum ENUM_STATUS Enum_TrieFind(struct Enum_TrieNode const* nodes,
+                                             char const* str,
+                                             size_t len,
+                                             int fold,
+                                             int abbreviate,
+                                             uint32_t* member)
+{
+    uint32_t node = 0;
+    size_t pos = 0;
+    int inside = 0;
+
+    while (pos < len)
+    {
+        unsigned char ch = Enum_TrieFold(str[pos], fold);
+        uint32_t child = nodes[node].child;
+        uint32_t end = child + nodes[node].children;
+        size_t matched = 1;
+
+        while (child < end && nodes[child].ch < ch)
+        {
+            ++child;
+        }
+
+        if (child == end || nodes[child].ch != ch)
+        {
+            return ENUM_E_UNKNOWN;
+        }
+
+        node = child;
+        while (matched < nodes[node].length && pos + matched < len
+               && Enum_TrieFold(str[pos + matched], fold) == Enum_TrieFold(nodes[node].label[matched], fold))
+        {
+            ++matched;
+        }
+
+        if (matched < nodes[node].length)
+        {
+            if (pos + matched < len)
+            {
+                return ENUM_E_UNKNOWN;
+            }
+
+            /* the input ends part way along the edge */
+            inside = 1;
+        }
+
+        pos += matched;
+    }
+
+    if (!inside && nodes[node].exact != 0)
+    {
+        *member = nodes[node].exact;
+        return ENUM_OK;
+    }
+
+    if (node == 0)
+    {
+        return ENUM_E_UNKNOWN;
+    }
+
+    if (nodes[node].below == ENUM_TRIE_MIXED)
+    {
+        return ENUM_E_AMBIGUOUS;
+    }
+
+    if (abbreviate)
+    {
+        *member = nodes[node].below;
+        return ENUM_OK;
+    }
+
+    return ENUM_E_UNKNOWN;
+}
+
+/**
+ *     @} // addtogroup Internal
+ */
+
+#endif /* ENUM_TRIE_H */
+
+/**
+ * @} // addtogroup C-Enum
+ */
@@ -1,7 +1,6 @@
 #include <stdio.h>
 #include "shape.h"
 
-ENUM_IMPL(SHAPE);
 ENUM_DEFINE_ITERATOR(SHAPE,
                      Shape_IteratorBegin,
                      Shape_IteratorEnd,
@@ -19,5 +18,7 @@ int main(void)
         iter++; // increment as an integer
     }
 
+    printf("%zu shapes, from %d to %d sides.\n", SHAPE_IMPL_COUNT, SHAPE_IMPL_MIN, SHAPE_IMPL_MAX);
+
     return 0;
 }
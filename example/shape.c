@@ -1,5 +1,7 @@
 #include "shape.h"
 
-ENUM_IMPL(SHAPE);
+ENUM_TRAITS(SHAPE);
+ENUM_DEFINE_IMPL(SHAPE);
+ENUM_DEFINE_IMPL_RANGE(SHAPE);
 ENUM_DEFINE_TOSTRING(SHAPE, Shape_ToString)
 
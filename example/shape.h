@@ -17,6 +17,9 @@
 /* Declare the ENUM */
 ENUM(SHAPE);
 
+/* Declare the SHAPE_IMPL table, defined once in shape.c */
+ENUM_DECLARE_IMPL(SHAPE);
+
 /* Declare the Shape_ToString(enum SHAPE) function */
 ENUM_DECLARE_TOSTRING(SHAPE, Shape_ToString);
 
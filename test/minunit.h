@@ -8,7 +8,7 @@
  *
  */
 
-#define mu_assert(message, test) do { if (!(test)) {return message;} } while (0)
+#define mu_assert(message, test) do { if (!(test)) {return (char*) (message);} } while (0)
 #define mu_run_test(test) do { char *message = test(); \
                                 if (message) {return message;} } while (0)
 
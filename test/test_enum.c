@@ -10,6 +10,23 @@
 #include <stdio.h>
 
 #include "enum.h"
+#include "enum_contiguous.h"
+#include "enum_monotonic.h"
+#include "enum_pool.h"
+#include "enum_soa.h"
+#include "enum_batch.h"
+#include "enum_flags.h"
+#include "enum_indexof.h"
+#include "enum_map.h"
+#include "enum_set.h"
+#include "enum_trie.h"
+#include "enum_isvalid.h"
+#include "enum_lookup.h"
+#include "enum_counter.h"
+#include "enum_packed.h"
+#include "enum_codec.h"
+#include "enum_hotcold.h"
+#include "enum_prefix.h"
 
 char* test_enum(void);
 
@@ -583,6 +600,1933 @@ static char* test_ReverseIterator(void)
     return 0;
 }
 
+/***********************************
+ * ENUM_DEFINE_TOSTRING_SWITCH tests
+ ***********************************/
+
+ENUM_DEFINE_TOSTRING_SWITCH(ITER, ITER_SwitchToString)
+
+/**
+ * Test the switch ToString matches the linear ToString, including for
+ * unknown values.
+ */
+static char* test_SwitchToString(void)
+{
+    int unknown[] = {-1, 4, INT_MIN, INT_MAX};
+    ITER_Iterator_t iter;
+    size_t idx;
+
+    for (iter = ITER_IteratorBegin(); iter <= ITER_IteratorEnd(); iter++)
+    {
+        enum ITER id = ITER_IteratorToValue(iter);
+        mu_assert("test_SwitchToString: switch and linear ToString differ",
+                  strcmp(ITER_ToString(id), ITER_SwitchToString(id)) == 0);
+    }
+
+    for (idx = 0; idx < sizeof(unknown) / sizeof(unknown[0]); ++idx)
+    {
+        mu_assert("test_SwitchToString: unknown value has a name",
+                  strcmp(ENUM_UNKNOWN_STRING,
+                         ITER_SwitchToString((enum ITER) unknown[idx])) == 0);
+    }
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_FROMSTRING tests
+ ***********************************/
+
+ENUM_DEFINE_FROMSTRING(VS, VS_FromString)
+ENUM_DEFINE_FROMSTRING(ITER, ITER_FromString)
+
+/**
+ * Test FromString inverts ToString for every element.
+ */
+static char* test_FromString(void)
+{
+    ITER_Iterator_t iter;
+
+    for (iter = ITER_IteratorBegin(); iter <= ITER_IteratorEnd(); iter++)
+    {
+        enum ITER id = ITER_IteratorToValue(iter);
+        enum ITER found = ITER_IteratorToValue(ITER_IteratorEnd() - iter);
+        const char* name = ITER_ToString(id);
+
+        mu_assert("test_FromString: ITER name not found",
+                  ITER_FromString(name, strlen(name), &found) == ENUM_OK);
+        mu_assert("test_FromString: ITER name maps to the wrong element",
+                  found == id);
+    }
+
+    return 0;
+}
+
+/**
+ * Test FromString reads exactly the given length and rejects unknown names.
+ */
+static char* test_FromStringLength(void)
+{
+    const char* token = "VS_0VS 2 Bug";
+    enum VS found = VS_1;
+
+    mu_assert("test_FromStringLength: 'VS_0' not found",
+              VS_FromString(token, 4, &found) == ENUM_OK && found == VS_0);
+    mu_assert("test_FromStringLength: 'VS 2' not found",
+              VS_FromString(token + 4, 4, &found) == ENUM_OK && found == VS_2);
+    mu_assert("test_FromStringLength: 'Bug' not found",
+              VS_FromString(token + 9, 3, &found) == ENUM_OK && found == VS_BUG);
+
+    found = VS_1;
+    mu_assert("test_FromStringLength: 'VS_' found",
+              VS_FromString(token, 3, &found) == ENUM_E_UNKNOWN);
+    mu_assert("test_FromStringLength: 'VS_0V' found",
+              VS_FromString(token, 5, &found) == ENUM_E_UNKNOWN);
+    mu_assert("test_FromStringLength: '' found",
+              VS_FromString(token, 0, &found) == ENUM_E_UNKNOWN);
+    mu_assert("test_FromStringLength: 'vs_0' found",
+              VS_FromString("vs_0", 4, &found) == ENUM_E_UNKNOWN);
+    mu_assert("test_FromStringLength: unknown name changed the result",
+              found == VS_1);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_TOSTRING_CONTIGUOUS tests
+ ***********************************/
+
+#define CONTIGUOUS(_, _V, _S, _VS) \
+    _V(CONTIGUOUS_MINUS_2, -2) \
+    _(CONTIGUOUS_MINUS_1) \
+    _S(CONTIGUOUS_0, "Contiguous 0") \
+    _(CONTIGUOUS_1) \
+    _VS(CONTIGUOUS_2, 2, "Contiguous 2") \
+
+ENUM(CONTIGUOUS);
+ENUM_IMPL(CONTIGUOUS);
+ENUM_DEFINE_TOSTRING(CONTIGUOUS, CONTIGUOUS_ToString)
+ENUM_DEFINE_TOSTRING_CONTIGUOUS(CONTIGUOUS, CONTIGUOUS_DenseToString)
+ENUM_DEFINE_ITERATOR(CONTIGUOUS,
+                     CONTIGUOUS_IteratorBegin,
+                     CONTIGUOUS_IteratorEnd,
+                     CONTIGUOUS_IteratorToValue)
+
+ENUM(DISCONTINUITY);
+
+/**
+ * Test the contiguity check against contiguous and discontinuous enums.
+ */
+static char* test_IsContiguous(void)
+{
+    mu_assert("test_IsContiguous: CONTIGUOUS not contiguous",
+              ENUM_IS_CONTIGUOUS(CONTIGUOUS));
+    mu_assert("test_IsContiguous: ITER not contiguous",
+              ENUM_IS_CONTIGUOUS(ITER));
+    mu_assert("test_IsContiguous: DISCONTINUITY is contiguous",
+              !ENUM_IS_CONTIGUOUS(DISCONTINUITY));
+    mu_assert("test_IsContiguous: VS is contiguous",
+              !ENUM_IS_CONTIGUOUS(VS));
+
+    return 0;
+}
+
+/**
+ * Test the dense ToString matches the linear ToString for every element.
+ */
+static char* test_ContiguousToString(void)
+{
+    CONTIGUOUS_Iterator_t iter;
+
+    for (iter = CONTIGUOUS_IteratorBegin(); iter <= CONTIGUOUS_IteratorEnd(); iter++)
+    {
+        enum CONTIGUOUS id = CONTIGUOUS_IteratorToValue(iter);
+        mu_assert("test_ContiguousToString: dense and linear ToString differ",
+                  strcmp(CONTIGUOUS_ToString(id), CONTIGUOUS_DenseToString(id)) == 0);
+    }
+
+    mu_assert("test_ContiguousToString: ToString(CONTIGUOUS_0) not equal to 'Contiguous 0'",
+              strcmp("Contiguous 0", CONTIGUOUS_DenseToString(CONTIGUOUS_0)) == 0);
+
+    return 0;
+}
+
+/**
+ * Test the dense ToString rejects values outside the enum's range.
+ */
+static char* test_ContiguousToStringUnknown(void)
+{
+    int unknown[] = {-3, 3, INT_MIN, INT_MAX};
+    size_t idx;
+
+    for (idx = 0; idx < sizeof(unknown) / sizeof(unknown[0]); ++idx)
+    {
+        enum CONTIGUOUS id = (enum CONTIGUOUS) unknown[idx];
+        mu_assert("test_ContiguousToStringUnknown: out of range value has a name",
+                  strcmp(ENUM_UNKNOWN_STRING, CONTIGUOUS_DenseToString(id)) == 0);
+        mu_assert("test_ContiguousToStringUnknown: dense and linear ToString differ",
+                  strcmp(CONTIGUOUS_ToString(id), CONTIGUOUS_DenseToString(id)) == 0);
+    }
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_*_MONOTONIC tests
+ ***********************************/
+
+#define MONOTONIC(_, _V, _S, _VS) \
+    _V(MONOTONIC_MINUS_7, -7) \
+    _V(MONOTONIC_1, 1) \
+    _(MONOTONIC_2) \
+    _VS(MONOTONIC_2_ALIAS, 2, "Monotonic 2 Alias") \
+    _V(MONOTONIC_100, 100) \
+    _S(MONOTONIC_101, "Monotonic 101") \
+    _VS(MONOTONIC_4000, 4000, "Monotonic 4000") \
+    _V(MONOTONIC_4000_ALIAS, 4000) \
+
+ENUM(MONOTONIC);
+ENUM_IMPL(MONOTONIC);
+ENUM_DEFINE_TOSTRING(MONOTONIC, MONOTONIC_ToString)
+ENUM_DEFINE_TOSTRING_MONOTONIC(MONOTONIC, MONOTONIC_SortedToString)
+ENUM_DEFINE_INDEXOF_MONOTONIC(MONOTONIC, MONOTONIC_IndexOf)
+ENUM_DEFINE_ITERATOR(MONOTONIC,
+                     MONOTONIC_IteratorBegin,
+                     MONOTONIC_IteratorEnd,
+                     MONOTONIC_IteratorToValue)
+
+ENUM(NON_MONOTONIC);
+
+/**
+ * Test the monotonicity check against sorted and unsorted enums.
+ */
+static char* test_IsMonotonic(void)
+{
+    mu_assert("test_IsMonotonic: MONOTONIC not monotonic",
+              ENUM_IS_MONOTONIC(MONOTONIC));
+    mu_assert("test_IsMonotonic: VS not monotonic",
+              ENUM_IS_MONOTONIC(VS));
+    mu_assert("test_IsMonotonic: NON_MONOTONIC is monotonic",
+              !ENUM_IS_MONOTONIC(NON_MONOTONIC));
+
+    return 0;
+}
+
+/**
+ * Test the binary-search ToString matches the linear ToString, including
+ * for duplicate and unknown values.
+ */
+static char* test_MonotonicToString(void)
+{
+    int unknown[] = {-8, 0, 3, 99, 102, 3999, 4001, INT_MIN, INT_MAX};
+    MONOTONIC_Iterator_t iter;
+    size_t idx;
+
+    for (iter = MONOTONIC_IteratorBegin(); iter <= MONOTONIC_IteratorEnd(); iter++)
+    {
+        enum MONOTONIC id = MONOTONIC_IteratorToValue(iter);
+        mu_assert("test_MonotonicToString: sorted and linear ToString differ",
+                  strcmp(MONOTONIC_ToString(id), MONOTONIC_SortedToString(id)) == 0);
+    }
+
+    mu_assert("test_MonotonicToString: ToString(MONOTONIC_2_ALIAS) not equal to 'MONOTONIC_2'",
+              strcmp("MONOTONIC_2", MONOTONIC_SortedToString(MONOTONIC_2_ALIAS)) == 0);
+    mu_assert("test_MonotonicToString: ToString(MONOTONIC_4000_ALIAS) not equal to 'Monotonic 4000'",
+              strcmp("Monotonic 4000", MONOTONIC_SortedToString(MONOTONIC_4000_ALIAS)) == 0);
+
+    for (idx = 0; idx < sizeof(unknown) / sizeof(unknown[0]); ++idx)
+    {
+        mu_assert("test_MonotonicToString: unknown value has a name",
+                  strcmp(ENUM_UNKNOWN_STRING,
+                         MONOTONIC_SortedToString((enum MONOTONIC) unknown[idx])) == 0);
+    }
+
+    return 0;
+}
+
+/**
+ * Test IndexOf inverts the iterator, resolving duplicates to the first
+ * element.
+ */
+static char* test_MonotonicIndexOf(void)
+{
+    MONOTONIC_Iterator_t iter;
+
+    for (iter = MONOTONIC_IteratorBegin(); iter <= MONOTONIC_IteratorEnd(); iter++)
+    {
+        enum MONOTONIC id = MONOTONIC_IteratorToValue(iter);
+        MONOTONIC_Iterator_t found = MONOTONIC_IndexOf(id);
+
+        mu_assert("test_MonotonicIndexOf: IndexOf does not map back to the value",
+                  found != ENUM_INDEX_UNKNOWN && MONOTONIC_IteratorToValue(found) == id);
+        mu_assert("test_MonotonicIndexOf: IndexOf is not the first element",
+                  found <= iter);
+    }
+
+    mu_assert("test_MonotonicIndexOf: IndexOf(MONOTONIC_2_ALIAS) not equal to 2",
+              MONOTONIC_IndexOf(MONOTONIC_2_ALIAS) == 2);
+    mu_assert("test_MonotonicIndexOf: IndexOf(MONOTONIC_4000_ALIAS) not equal to 6",
+              MONOTONIC_IndexOf(MONOTONIC_4000_ALIAS) == 6);
+    mu_assert("test_MonotonicIndexOf: IndexOf(3) not unknown",
+              MONOTONIC_IndexOf((enum MONOTONIC) 3) == ENUM_INDEX_UNKNOWN);
+    mu_assert("test_MonotonicIndexOf: IndexOf(INT_MAX) not unknown",
+              MONOTONIC_IndexOf((enum MONOTONIC) INT_MAX) == ENUM_INDEX_UNKNOWN);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_IMPL_POOL tests
+ ***********************************/
+
+#define POOLED(_, _V, _S, _VS) \
+    _(POOLED_0) \
+    _V(POOLED_1, 1) \
+    _S(POOLED_2, "Pooled 2") \
+    _VS(POOLED_4, 4, "Pooled 4") \
+    _VS(POOLED_BUG, 4, "Bug") \
+
+ENUM(POOLED);
+ENUM_IMPL_POOL(POOLED, uint16_t);
+ENUM_DEFINE_TOSTRING(POOLED, POOLED_ToString)
+ENUM_DEFINE_TOSTRING_MONOTONIC(POOLED, POOLED_SortedToString)
+ENUM_DEFINE_FROMSTRING(POOLED, POOLED_FromString)
+ENUM_DEFINE_ITERATOR(POOLED,
+                     POOLED_IteratorBegin,
+                     POOLED_IteratorEnd,
+                     POOLED_IteratorToValue)
+
+#define POOLED_DENSE(_, _V, _S, _VS) \
+    _V(POOLED_DENSE_MINUS_1, -1) \
+    _S(POOLED_DENSE_0, "") \
+    _(POOLED_DENSE_1) \
+
+ENUM(POOLED_DENSE);
+ENUM_IMPL_POOL(POOLED_DENSE, uint32_t);
+ENUM_DEFINE_TOSTRING_CONTIGUOUS(POOLED_DENSE, POOLED_DENSE_ToString)
+
+/**
+ * Test ToString, FromString and iteration over a string-pool table.
+ */
+static char* test_PoolToString(void)
+{
+    size_t count = 0;
+    POOLED_Iterator_t iter;
+    const char* expected[] = {"POOLED_0", "POOLED_1", "Pooled 2", "Pooled 4", "Bug"};
+
+    for (iter = POOLED_IteratorBegin(); iter <= POOLED_IteratorEnd(); iter++)
+    {
+        enum POOLED id = POOLED_IteratorToValue(iter);
+        enum POOLED found = POOLED_0;
+
+        mu_assert("test_PoolToString: name not equal to expected",
+                  strcmp(expected[count], POOLED_NameAt(iter)) == 0);
+        mu_assert("test_PoolToString: FromString does not invert the name",
+                  POOLED_FromString(expected[count], strlen(expected[count]), &found) == ENUM_OK
+                  && found == id);
+        count++;
+    }
+    mu_assert("test_PoolToString: incorrect iteration count", count == 5);
+
+    mu_assert("test_PoolToString: ToString(POOLED_2) not equal to 'Pooled 2'",
+              strcmp("Pooled 2", POOLED_ToString(POOLED_2)) == 0);
+    mu_assert("test_PoolToString: ToString(POOLED_BUG) not equal to 'Pooled 4'",
+              strcmp("Pooled 4", POOLED_SortedToString(POOLED_BUG)) == 0);
+    mu_assert("test_PoolToString: ToString(3) not unknown",
+              strcmp(ENUM_UNKNOWN_STRING, POOLED_ToString((enum POOLED) 3)) == 0);
+
+    mu_assert("test_PoolToString: ToString(POOLED_DENSE_0) not empty",
+              strcmp("", POOLED_DENSE_ToString(POOLED_DENSE_0)) == 0);
+    mu_assert("test_PoolToString: ToString(POOLED_DENSE_1) not equal to 'POOLED_DENSE_1'",
+              strcmp("POOLED_DENSE_1", POOLED_DENSE_ToString(POOLED_DENSE_1)) == 0);
+
+    return 0;
+}
+
+/**
+ * Test the string-pool table is smaller than the pointer table.
+ */
+static char* test_PoolSize(void)
+{
+    mu_assert("test_PoolSize: pooled entry not smaller than a pointer entry",
+              sizeof(*POOLED_IMPL) + sizeof(uint16_t) < sizeof(*VS_IMPL));
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_IMPL_SOA tests
+ ***********************************/
+
+#define SOA(_, _V, _S, _VS) \
+    _V(SOA_900, 900) \
+    _V(SOA_MINUS_5, -5) \
+    _S(SOA_MINUS_4, "Soa -4") \
+    _V(SOA_40, 40) \
+    _V(SOA_7, 7) \
+    _V(SOA_12, 12) \
+    _V(SOA_1000, 1000) \
+    _VS(SOA_7_ALIAS, 7, "Soa 7 Alias") \
+    _V(SOA_3, 3) \
+    _V(SOA_INT_MIN, INT_MIN) \
+    _V(SOA_INT_MAX, INT_MAX) \
+    _V(SOA_2, 2) \
+
+ENUM(SOA);
+ENUM_IMPL_SOA(SOA);
+ENUM_DEFINE_TOSTRING(SOA, SOA_ToString)
+ENUM_DEFINE_TOSTRING_SOA(SOA, SOA_VectorToString)
+ENUM_DEFINE_INDEXOF_SOA(SOA, SOA_IndexOf)
+ENUM_DEFINE_ITERATOR(SOA,
+                     SOA_IteratorBegin,
+                     SOA_IteratorEnd,
+                     SOA_IteratorToValue)
+
+ENUM_DEFINE_TOSTRING_SOA(POOLED, POOLED_VectorToString)
+
+/**
+ * Test the vectorised ToString and IndexOf match a linear search, across
+ * vector blocks and the scalar tail.
+ */
+static char* test_SoaToString(void)
+{
+    int unknown[] = {0, 1, 8, 41, 999, INT_MIN + 1, INT_MAX - 1};
+    SOA_Iterator_t iter;
+    size_t idx;
+
+    for (iter = SOA_IteratorBegin(); iter <= SOA_IteratorEnd(); iter++)
+    {
+        enum SOA id = SOA_IteratorToValue(iter);
+        SOA_Iterator_t first = SOA_IndexOf(id);
+
+        mu_assert("test_SoaToString: vector and linear ToString differ",
+                  strcmp(SOA_ToString(id), SOA_VectorToString(id)) == 0);
+        mu_assert("test_SoaToString: IndexOf does not map back to the value",
+                  first <= iter && SOA_IteratorToValue(first) == id);
+    }
+
+    mu_assert("test_SoaToString: ToString(SOA_7_ALIAS) not equal to 'SOA_7'",
+              strcmp("SOA_7", SOA_VectorToString(SOA_7_ALIAS)) == 0);
+    mu_assert("test_SoaToString: ToString(-4) not equal to 'Soa -4'",
+              strcmp("Soa -4", SOA_VectorToString((enum SOA) -4)) == 0);
+
+    for (idx = 0; idx < sizeof(unknown) / sizeof(unknown[0]); ++idx)
+    {
+        mu_assert("test_SoaToString: unknown value has a name",
+                  strcmp(ENUM_UNKNOWN_STRING, SOA_VectorToString((enum SOA) unknown[idx])) == 0);
+        mu_assert("test_SoaToString: unknown value has an index",
+                  SOA_IndexOf((enum SOA) unknown[idx]) == ENUM_INDEX_UNKNOWN);
+    }
+
+    mu_assert("test_SoaToString: pooled ToString(POOLED_BUG) not equal to 'Pooled 4'",
+              strcmp("Pooled 4", POOLED_VectorToString(POOLED_BUG)) == 0);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_*_BATCH tests
+ ***********************************/
+
+ENUM_DEFINE_TOSTRING_BATCH(MONOTONIC, MONOTONIC_ToStringBatch, MONOTONIC_IndexOf)
+ENUM_DEFINE_INDEXOF_BATCH(MONOTONIC, MONOTONIC_IndexOfBatch, MONOTONIC_IndexOf)
+ENUM_DEFINE_TOSTRING_BATCH(SOA, SOA_ToStringBatch, SOA_IndexOf)
+ENUM_DEFINE_INDEXOF_BATCH(SOA, SOA_IndexOfBatch, SOA_IndexOf)
+
+/**
+ * Test batch lookups through the dense map, which MONOTONIC's range allows,
+ * for arrays both shorter and longer than the enum.
+ */
+static char* test_MonotonicBatch(void)
+{
+    enum MONOTONIC in[] =
+    {
+        MONOTONIC_4000, (enum MONOTONIC) 3, MONOTONIC_2_ALIAS, MONOTONIC_2_ALIAS,
+        MONOTONIC_MINUS_7, (enum MONOTONIC) -8, (enum MONOTONIC) 4001, MONOTONIC_101,
+        MONOTONIC_1, MONOTONIC_100,
+    };
+    size_t n = sizeof(in) / sizeof(in[0]);
+    char const* names[sizeof(in) / sizeof(in[0])];
+    MONOTONIC_Iterator_t index[sizeof(in) / sizeof(in[0])];
+    size_t len;
+
+    for (len = n / 2; len <= n; len += n / 2)
+    {
+        size_t idx;
+
+        mu_assert("test_MonotonicBatch: ToString batch miscounts unknowns",
+                  MONOTONIC_ToStringBatch(in, len, names) == (len == n ? 3 : 1));
+        mu_assert("test_MonotonicBatch: IndexOf batch miscounts unknowns",
+                  MONOTONIC_IndexOfBatch(in, len, index) == (len == n ? 3 : 1));
+
+        for (idx = 0; idx < len; ++idx)
+        {
+            MONOTONIC_Iterator_t expected = MONOTONIC_IndexOf(in[idx]);
+
+            mu_assert("test_MonotonicBatch: batch index differs from IndexOf",
+                      index[idx] == expected);
+            mu_assert("test_MonotonicBatch: batch name differs from ToString",
+                      expected == ENUM_INDEX_UNKNOWN ? names[idx] == NULL
+                      : strcmp(names[idx], MONOTONIC_ToString(in[idx])) == 0);
+        }
+    }
+
+    mu_assert("test_MonotonicBatch: ToString(MONOTONIC_2_ALIAS) not equal to 'MONOTONIC_2'",
+              strcmp("MONOTONIC_2", names[2]) == 0);
+
+    return 0;
+}
+
+/**
+ * Test batch lookups over an enum whose range is too wide for a dense map.
+ */
+static char* test_SoaBatch(void)
+{
+    enum SOA in[] =
+    {
+        SOA_INT_MAX, SOA_INT_MIN, (enum SOA) 0, SOA_7_ALIAS, SOA_7, SOA_7,
+        SOA_MINUS_4, (enum SOA) 0, SOA_2, SOA_900, SOA_1000, SOA_12, SOA_40,
+        (enum SOA) 41,
+    };
+    size_t n = sizeof(in) / sizeof(in[0]);
+    char const* names[sizeof(in) / sizeof(in[0])];
+    SOA_Iterator_t index[sizeof(in) / sizeof(in[0])];
+    size_t idx;
+
+    mu_assert("test_SoaBatch: ToString batch miscounts unknowns",
+              SOA_ToStringBatch(in, n, names) == 3);
+    mu_assert("test_SoaBatch: IndexOf batch miscounts unknowns",
+              SOA_IndexOfBatch(in, n, index) == 3);
+
+    for (idx = 0; idx < n; ++idx)
+    {
+        mu_assert("test_SoaBatch: batch index differs from IndexOf",
+                  index[idx] == SOA_IndexOf(in[idx]));
+        mu_assert("test_SoaBatch: batch name differs from ToString",
+                  index[idx] == ENUM_INDEX_UNKNOWN ? names[idx] == NULL
+                  : strcmp(names[idx], SOA_ToString(in[idx])) == 0);
+    }
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_FLAGS_* tests
+ ***********************************/
+
+#define FLAGS(_, _V, _S, _VS) \
+    _V(FLAGS_NONE, 0) \
+    _V(FLAGS_READ, (1u << 0)) \
+    _V(FLAGS_WRITE, (1u << 1)) \
+    _V(FLAGS_RW, FLAGS_READ | FLAGS_WRITE) \
+    _VS(FLAGS_EXEC, (1u << 2), "Exec") \
+    _V(FLAGS_EXEC_ALIAS, (1u << 2)) \
+    _V(FLAGS_STICKY, (1u << 9)) \
+
+ENUM(FLAGS);
+ENUM_IMPL(FLAGS);
+ENUM_DEFINE_FROMSTRING(FLAGS, FLAGS_FromName)
+ENUM_DEFINE_FLAGS_BITNAME(FLAGS, FLAGS_BitName)
+ENUM_DEFINE_FLAGS_TOSTRING(FLAGS, FLAGS_ToString, FLAGS_BitName)
+ENUM_DEFINE_FLAGS_FROMSTRING(FLAGS, FLAGS_FromString, FLAGS_FromName)
+
+/**
+ * Test masks are formatted bit by bit, with unnamed bits in hexadecimal.
+ */
+static char* test_FlagsToString(void)
+{
+    char buf[64];
+
+    mu_assert("test_FlagsToString: BitName(2) not equal to 'Exec'",
+              strcmp("Exec", FLAGS_BitName(2)) == 0);
+    mu_assert("test_FlagsToString: unnamed bit has a name",
+              FLAGS_BitName(3) == NULL && FLAGS_BitName(64) == NULL);
+
+    mu_assert("test_FlagsToString: wrong length of READ|WRITE|Exec",
+              FLAGS_ToString(FLAGS_RW | FLAGS_EXEC, buf, sizeof(buf)) == 27);
+    mu_assert("test_FlagsToString: RW|EXEC not equal to 'FLAGS_READ|FLAGS_WRITE|Exec'",
+              strcmp("FLAGS_READ|FLAGS_WRITE|Exec", buf) == 0);
+
+    FLAGS_ToString(FLAGS_STICKY | 0x10008u | FLAGS_READ, buf, sizeof(buf));
+    mu_assert("test_FlagsToString: unnamed bits not equal to 'FLAGS_READ|FLAGS_STICKY|0x10008'",
+              strcmp("FLAGS_READ|FLAGS_STICKY|0x10008", buf) == 0);
+
+    FLAGS_ToString(0, buf, sizeof(buf));
+    mu_assert("test_FlagsToString: 0 not equal to '0'",
+              strcmp("0", buf) == 0);
+
+    return 0;
+}
+
+/**
+ * Test formatting truncates to the buffer and reports the full length.
+ */
+static char* test_FlagsToStringTruncated(void)
+{
+    char buf[12];
+
+    memset(buf, 'x', sizeof(buf));
+    mu_assert("test_FlagsToStringTruncated: wrong length",
+              FLAGS_ToString(FLAGS_READ | FLAGS_WRITE, buf, 8) == 22);
+    mu_assert("test_FlagsToStringTruncated: not truncated to 'FLAGS_R'",
+              strcmp("FLAGS_R", buf) == 0 && buf[8] == 'x');
+    mu_assert("test_FlagsToStringTruncated: wrong length with no buffer",
+              FLAGS_ToString(FLAGS_READ | FLAGS_WRITE, NULL, 0) == 22);
+
+    return 0;
+}
+
+/**
+ * Test parsing accepts names, multi-bit names and numbers, and round-trips.
+ */
+static char* test_FlagsFromString(void)
+{
+    char const* valid = "FLAGS_RW|Exec|0x8|FLAGS_NONE";
+    char const* invalid[] = {"", "|FLAGS_READ", "FLAGS_READ|", "FLAGS_READ||Exec"};
+    char buf[64];
+    uint64_t mask = 0;
+    size_t idx;
+
+    mu_assert("test_FlagsFromString: valid mask not parsed",
+              FLAGS_FromString(valid, strlen(valid), &mask) == ENUM_OK);
+    mu_assert("test_FlagsFromString: valid mask not equal to 0xf",
+              mask == 0xf);
+
+    mu_assert("test_FlagsFromString: formatted mask not parsed",
+              FLAGS_FromString(buf, FLAGS_ToString(0x20207u, buf, sizeof(buf)), &mask) == ENUM_OK);
+    mu_assert("test_FlagsFromString: formatted mask does not round-trip",
+              mask == 0x20207u);
+
+    mu_assert("test_FlagsFromString: 0 not parsed",
+              FLAGS_FromString("0", 1, &mask) == ENUM_OK && mask == 0);
+    mu_assert("test_FlagsFromString: unknown name parsed",
+              FLAGS_FromString("FLAGS_READ|FLAGS_BOGUS", 22, &mask) == ENUM_E_UNKNOWN);
+    mu_assert("test_FlagsFromString: bad number parsed",
+              FLAGS_FromString("0x1g", 4, &mask) == ENUM_E_UNKNOWN);
+
+    for (idx = 0; idx < sizeof(invalid) / sizeof(invalid[0]); ++idx)
+    {
+        mu_assert("test_FlagsFromString: empty term parsed",
+                  FLAGS_FromString(invalid[idx], strlen(invalid[idx]), &mask) == ENUM_E_SYNTAX);
+    }
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_INDEXOF tests
+ ***********************************/
+
+ENUM_DEFINE_INDEXOF(CONTIGUOUS, CONTIGUOUS_IndexOf)
+ENUM_DEFINE_INDEXOF(MONOTONIC, MONOTONIC_AnyIndexOf)
+ENUM_DEFINE_INDEXOF(SOA, SOA_HashIndexOf)
+
+/**
+ * Test IndexOf inverts the iterator for contiguous, monotonic and unsorted
+ * enums, and resolves duplicates to the first element.
+ */
+static char* test_IndexOf(void)
+{
+    int unknown[] = {-8, -3, 5, 4001, 41, 999, INT_MIN + 1, INT_MAX - 1};
+    CONTIGUOUS_Iterator_t citer;
+    MONOTONIC_Iterator_t miter;
+    SOA_Iterator_t siter;
+    size_t idx;
+
+    for (citer = CONTIGUOUS_IteratorBegin(); citer <= CONTIGUOUS_IteratorEnd(); citer++)
+    {
+        mu_assert("test_IndexOf: contiguous IndexOf does not invert the iterator",
+                  CONTIGUOUS_IndexOf(CONTIGUOUS_IteratorToValue(citer)) == citer);
+    }
+
+    for (miter = MONOTONIC_IteratorBegin(); miter <= MONOTONIC_IteratorEnd(); miter++)
+    {
+        enum MONOTONIC id = MONOTONIC_IteratorToValue(miter);
+
+        mu_assert("test_IndexOf: monotonic IndexOf differs from binary search",
+                  MONOTONIC_AnyIndexOf(id) == MONOTONIC_IndexOf(id));
+    }
+
+    for (siter = SOA_IteratorBegin(); siter <= SOA_IteratorEnd(); siter++)
+    {
+        enum SOA id = SOA_IteratorToValue(siter);
+
+        mu_assert("test_IndexOf: hashed IndexOf differs from linear search",
+                  SOA_HashIndexOf(id) == SOA_IndexOf(id));
+    }
+
+    mu_assert("test_IndexOf: IndexOf(SOA_7_ALIAS) not equal to IndexOf(SOA_7)",
+              SOA_HashIndexOf(SOA_7_ALIAS) == 4);
+
+    for (idx = 0; idx < sizeof(unknown) / sizeof(unknown[0]); ++idx)
+    {
+        mu_assert("test_IndexOf: unknown contiguous value has an index",
+                  CONTIGUOUS_IndexOf((enum CONTIGUOUS) unknown[idx]) == ENUM_INDEX_UNKNOWN);
+        mu_assert("test_IndexOf: unknown monotonic value has an index",
+                  MONOTONIC_AnyIndexOf((enum MONOTONIC) unknown[idx]) == ENUM_INDEX_UNKNOWN);
+        mu_assert("test_IndexOf: unknown hashed value has an index",
+                  SOA_HashIndexOf((enum SOA) unknown[idx]) == ENUM_INDEX_UNKNOWN);
+    }
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_MAP tests
+ ***********************************/
+
+ENUM_DECLARE_MAP(SOA, SoaMap, int);
+ENUM_DEFINE_MAP(SOA, SoaMap, int, SOA_HashIndexOf)
+
+ENUM_DECLARE_MAP(CONTIGUOUS, ContiguousMap, char const*);
+ENUM_DEFINE_MAP(CONTIGUOUS, ContiguousMap, char const*, CONTIGUOUS_IndexOf)
+
+/**
+ * Test maps keyed by sparse, negative and aliased values are dense, and
+ * iterate in declaration order.
+ */
+static char* test_Map(void)
+{
+    SoaMap_t squares = {{0}};
+    ContiguousMap_t names = {{0}};
+    SOA_Iterator_t iter;
+    int value = 0;
+
+    mu_assert("test_Map: map not sized to the member count",
+              sizeof(squares.values) / sizeof(squares.values[0]) == ENUM_COUNT(SOA)
+              && ENUM_COUNT(SOA) == sizeof(SOA_IMPL) / sizeof(*SOA_IMPL));
+
+    for (iter = SOA_IteratorBegin(); iter <= SOA_IteratorEnd(); iter++)
+    {
+        enum SOA key = SOA_IteratorToValue(iter);
+
+        mu_assert("test_Map: Set of an element failed",
+                  SoaMap_Set(&squares, key, (int) iter * (int) iter) == ENUM_OK);
+    }
+
+    mu_assert("test_Map: Get(SOA_INT_MIN) failed",
+              SoaMap_Get(&squares, SOA_INT_MIN, &value) == ENUM_OK && value == 81);
+    mu_assert("test_Map: Set(SOA_7_ALIAS) not shared with SOA_7",
+              SoaMap_Get(&squares, SOA_7, &value) == ENUM_OK && value == 49);
+    mu_assert("test_Map: alias entry not left unset",
+              squares.values[7] == 0);
+    mu_assert("test_Map: At(SOA_MINUS_5) not the second entry",
+              SoaMap_At(&squares, SOA_MINUS_5) == &squares.values[1]);
+
+    mu_assert("test_Map: Set of an unknown key succeeded",
+              SoaMap_Set(&squares, (enum SOA) 8, 1) == ENUM_E_UNKNOWN);
+    mu_assert("test_Map: Get of an unknown key succeeded",
+              SoaMap_Get(&squares, (enum SOA) 8, &value) == ENUM_E_UNKNOWN);
+    mu_assert("test_Map: At of an unknown key not NULL",
+              SoaMap_At(&squares, (enum SOA) 8) == NULL);
+
+    *ContiguousMap_At(&names, CONTIGUOUS_MINUS_2) = "minus two";
+    mu_assert("test_Map: At(CONTIGUOUS_MINUS_2) not the first entry",
+              names.values[0] != NULL && strcmp("minus two", names.values[0]) == 0);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_SET tests
+ ***********************************/
+
+/* more than 64 descending, negative and sparse values, two words per set */
+#define WIDE(_, _V, _S, _VS) \
+    _V(WIDE_0, 96) \
+    _V(WIDE_1, 93) \
+    _V(WIDE_2, 90) \
+    _V(WIDE_3, 87) \
+    _V(WIDE_4, 84) \
+    _V(WIDE_5, 81) \
+    _V(WIDE_6, 78) \
+    _V(WIDE_7, 75) \
+    _V(WIDE_8, 72) \
+    _V(WIDE_9, 69) \
+    _V(WIDE_10, 66) \
+    _V(WIDE_11, 63) \
+    _V(WIDE_12, 60) \
+    _V(WIDE_13, 57) \
+    _V(WIDE_14, 54) \
+    _V(WIDE_15, 51) \
+    _V(WIDE_16, 48) \
+    _V(WIDE_17, 45) \
+    _V(WIDE_18, 42) \
+    _V(WIDE_19, 39) \
+    _V(WIDE_20, 36) \
+    _V(WIDE_21, 33) \
+    _V(WIDE_22, 30) \
+    _V(WIDE_23, 27) \
+    _V(WIDE_24, 24) \
+    _V(WIDE_25, 21) \
+    _V(WIDE_26, 18) \
+    _V(WIDE_27, 15) \
+    _V(WIDE_28, 12) \
+    _V(WIDE_29, 9) \
+    _V(WIDE_30, 6) \
+    _V(WIDE_31, 3) \
+    _V(WIDE_32, 0) \
+    _V(WIDE_33, -3) \
+    _V(WIDE_34, -6) \
+    _V(WIDE_35, -9) \
+    _V(WIDE_36, -12) \
+    _V(WIDE_37, -15) \
+    _V(WIDE_38, -18) \
+    _V(WIDE_39, -21) \
+    _V(WIDE_40, -24) \
+    _V(WIDE_41, -27) \
+    _V(WIDE_42, -30) \
+    _V(WIDE_43, -33) \
+    _V(WIDE_44, -36) \
+    _V(WIDE_45, -39) \
+    _V(WIDE_46, -42) \
+    _V(WIDE_47, -45) \
+    _V(WIDE_48, -48) \
+    _V(WIDE_49, -51) \
+    _V(WIDE_50, -54) \
+    _V(WIDE_51, -57) \
+    _V(WIDE_52, -60) \
+    _V(WIDE_53, -63) \
+    _V(WIDE_54, -66) \
+    _V(WIDE_55, -69) \
+    _V(WIDE_56, -72) \
+    _V(WIDE_57, -75) \
+    _V(WIDE_58, -78) \
+    _V(WIDE_59, -81) \
+    _V(WIDE_60, -84) \
+    _V(WIDE_61, -87) \
+    _V(WIDE_62, -90) \
+    _V(WIDE_63, -93) \
+    _V(WIDE_64, -96) \
+    _V(WIDE_65, -99) \
+
+ENUM(WIDE);
+ENUM_IMPL(WIDE);
+ENUM_DEFINE_INDEXOF(WIDE, WIDE_IndexOf)
+ENUM_DEFINE_ITERATOR(WIDE,
+                     WIDE_IteratorBegin,
+                     WIDE_IteratorEnd,
+                     WIDE_IteratorToValue)
+
+ENUM_DECLARE_SET(WIDE, WideSet);
+ENUM_DEFINE_SET(WIDE, WideSet, WIDE_IndexOf)
+
+ENUM_DECLARE_SET(SOA, SoaSet);
+ENUM_DEFINE_SET(SOA, SoaSet, SOA_HashIndexOf)
+
+/**
+ * Test insert, erase and membership across word boundaries.
+ */
+static char* test_Set(void)
+{
+    WideSet_t set = {{0}};
+    SoaSet_t soa = {{0}};
+
+    mu_assert("test_Set: set not sized to two words",
+              sizeof(set.words) == 2 * sizeof(uint64_t));
+
+    mu_assert("test_Set: Insert(WIDE_0) failed",
+              WideSet_Insert(&set, WIDE_0) == ENUM_OK);
+    mu_assert("test_Set: Insert(WIDE_65) failed",
+              WideSet_Insert(&set, WIDE_65) == ENUM_OK);
+    mu_assert("test_Set: Insert(WIDE_64) failed",
+              WideSet_Insert(&set, WIDE_64) == ENUM_OK);
+    mu_assert("test_Set: Insert of an unknown value succeeded",
+              WideSet_Insert(&set, (enum WIDE) 1) == ENUM_E_UNKNOWN);
+
+    mu_assert("test_Set: WIDE_65 not a member",
+              WideSet_Contains(&set, WIDE_65));
+    mu_assert("test_Set: WIDE_63 is a member",
+              !WideSet_Contains(&set, WIDE_63));
+    mu_assert("test_Set: unknown value is a member",
+              !WideSet_Contains(&set, (enum WIDE) 1));
+    mu_assert("test_Set: Count not equal to 3",
+              WideSet_Count(&set) == 3);
+
+    mu_assert("test_Set: Erase(WIDE_64) failed",
+              WideSet_Erase(&set, WIDE_64) == ENUM_OK && !WideSet_Contains(&set, WIDE_64));
+    mu_assert("test_Set: Count not equal to 2",
+              WideSet_Count(&set) == 2);
+
+    SoaSet_Insert(&soa, SOA_7_ALIAS);
+    mu_assert("test_Set: SOA_7 does not share the bit of SOA_7_ALIAS",
+              SoaSet_Contains(&soa, SOA_7) && SoaSet_Count(&soa) == 1);
+
+    return 0;
+}
+
+/**
+ * Test union, intersection and iteration in declaration order.
+ */
+static char* test_SetIteration(void)
+{
+    WideSet_t odd = {{0}};
+    WideSet_t low = {{0}};
+    WIDE_Iterator_t iter;
+    size_t count = 0;
+
+    for (iter = WIDE_IteratorBegin(); iter <= WIDE_IteratorEnd(); iter++)
+    {
+        if (iter % 2)
+        {
+            WideSet_Insert(&odd, WIDE_IteratorToValue(iter));
+        }
+        if (iter < 8 || iter > 62)
+        {
+            WideSet_Insert(&low, WIDE_IteratorToValue(iter));
+        }
+    }
+
+    WideSet_Intersection(&odd, &low);
+
+    for (iter = WideSet_Next(&odd, ENUM_INDEX_UNKNOWN);
+         iter != ENUM_INDEX_UNKNOWN;
+         iter = WideSet_Next(&odd, iter))
+    {
+        mu_assert("test_SetIteration: iterated a non-member",
+                  iter % 2 && (iter < 8 || iter > 62));
+        mu_assert("test_SetIteration: iterator does not map to a member",
+                  WideSet_Contains(&odd, WIDE_IteratorToValue(iter)));
+        count++;
+    }
+
+    mu_assert("test_SetIteration: intersection not equal to 1, 3, 5, 7, 63, 65",
+              count == 6 && WideSet_Count(&odd) == 6);
+
+    WideSet_Union(&odd, &low);
+    mu_assert("test_SetIteration: union not equal to the low set",
+              WideSet_Count(&odd) == 11 && odd.words[0] == low.words[0]
+              && odd.words[1] == low.words[1]);
+
+    memset(&low, 0, sizeof(low));
+    mu_assert("test_SetIteration: empty set has a member",
+              WideSet_Next(&low, ENUM_INDEX_UNKNOWN) == ENUM_INDEX_UNKNOWN);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DECLARE_IMPL / ENUM_DEFINE_IMPL tests
+ ***********************************/
+
+#define SHARED(_, _V, _S, _VS) \
+    _V(SHARED_5, 5) \
+    _V(SHARED_MINUS_2, -2) \
+    _(SHARED_MINUS_1) \
+    _S(SHARED_0, "Shared 0") \
+    _V(SHARED_8, 8) \
+    _V(SHARED_5_ALIAS, 5) \
+
+#define SHARED_INT(_, _V, _S, _VS) \
+    _V(SHARED_INT_0, 0) \
+    _V(SHARED_INT_HIGH, INT_MAX) \
+    _V(SHARED_INT_LOW, INT_MIN) \
+    _V(SHARED_INT_LOW_1, INT_MIN + 1) \
+
+#define SHARED_ALL_MIN(_, _V, _S, _VS) \
+    _V(SHARED_ALL_MIN_A, INT_MIN) \
+    _V(SHARED_ALL_MIN_B, INT_MIN) \
+
+/* as a header would declare them */
+ENUM(SHARED);
+ENUM_DECLARE_IMPL(SHARED);
+ENUM_TRAITS(SHARED);
+ENUM(SHARED_INT);
+ENUM_DECLARE_IMPL(SHARED_INT);
+ENUM_TRAITS(SHARED_INT);
+ENUM(SHARED_ALL_MIN);
+ENUM_DECLARE_IMPL(SHARED_ALL_MIN);
+ENUM_TRAITS(SHARED_ALL_MIN);
+
+ENUM_DEFINE_TOSTRING(SHARED, SHARED_ToString)
+ENUM_DEFINE_ITERATOR(SHARED,
+                     SHARED_IteratorBegin,
+                     SHARED_IteratorEnd,
+                     SHARED_IteratorToValue)
+
+/* as the one defining translation unit would define them */
+ENUM_DEFINE_IMPL(SHARED);
+ENUM_DEFINE_IMPL_RANGE(SHARED);
+ENUM_DEFINE_IMPL(SHARED_INT);
+ENUM_DEFINE_IMPL_RANGE(SHARED_INT);
+ENUM_DEFINE_IMPL(SHARED_ALL_MIN);
+ENUM_DEFINE_IMPL_RANGE(SHARED_ALL_MIN);
+
+/**
+ * Test functions over an extern table, and its count, min and max.
+ */
+static char* test_SharedImpl(void)
+{
+    SHARED_Iterator_t iter;
+    int sum = 0;
+
+    mu_assert("test_SharedImpl: ToString(SHARED_0) not equal to 'Shared 0'",
+              strcmp("Shared 0", SHARED_ToString(SHARED_0)) == 0);
+    mu_assert("test_SharedImpl: ToString(SHARED_5_ALIAS) not equal to 'SHARED_5'",
+              strcmp("SHARED_5", SHARED_ToString(SHARED_5_ALIAS)) == 0);
+
+    for (iter = SHARED_IteratorBegin(); iter <= SHARED_IteratorEnd(); iter++)
+    {
+        sum += SHARED_IteratorToValue(iter);
+    }
+
+    mu_assert("test_SharedImpl: iterated values do not sum to 15",
+              sum == 15);
+
+    mu_assert("test_SharedImpl: SHARED_IMPL_COUNT not equal to 6",
+              SHARED_IMPL_COUNT == 6 && ENUM_COUNT(SHARED) == 6);
+    mu_assert("test_SharedImpl: SHARED_IMPL_MIN not equal to -2",
+              SHARED_IMPL_MIN == SHARED_MINUS_2);
+    mu_assert("test_SharedImpl: SHARED_IMPL_MAX not equal to 8",
+              SHARED_IMPL_MAX == SHARED_8);
+
+    mu_assert("test_SharedImpl: SHARED_INT_IMPL_MIN not equal to INT_MIN",
+              (int) SHARED_INT_IMPL_MIN == INT_MIN);
+    mu_assert("test_SharedImpl: SHARED_INT_IMPL_MAX not equal to INT_MAX",
+              (int) SHARED_INT_IMPL_MAX == INT_MAX);
+    mu_assert("test_SharedImpl: SHARED_ALL_MIN_IMPL_MIN not equal to INT_MIN",
+              (int) SHARED_ALL_MIN_IMPL_MIN == INT_MIN);
+    mu_assert("test_SharedImpl: SHARED_ALL_MIN_IMPL_MAX not equal to INT_MIN",
+              (int) SHARED_ALL_MIN_IMPL_MAX == INT_MIN);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_TOSTRING_VIEW tests
+ ***********************************/
+
+static const char NONLITERAL_NAME[] = "Not a literal";
+
+#define NONLITERAL(_, _V, _S, _VS) \
+    _(NONLITERAL_A) \
+    _S(NONLITERAL_B, NONLITERAL_NAME) \
+
+ENUM(NONLITERAL);
+ENUM_IMPL(NONLITERAL);
+ENUM_DEFINE_TOSTRING(NONLITERAL, NONLITERAL_ToString)
+
+ENUM_DEFINE_INDEXOF(VS, VS_IndexOf)
+ENUM_DEFINE_INDEXOF(NONLITERAL, NONLITERAL_IndexOf)
+ENUM_DEFINE_INDEXOF(POOLED, POOLED_IndexOf)
+ENUM_DEFINE_INDEXOF(POOLED_DENSE, POOLED_DENSE_IndexOf)
+ENUM_DEFINE_INDEXOF(SHARED, SHARED_IndexOf)
+
+ENUM_DEFINE_TOSTRING_VIEW(VS, VS_ToStringView, VS_IndexOf)
+ENUM_DEFINE_TOSTRING_VIEW(NONLITERAL, NONLITERAL_ToStringView, NONLITERAL_IndexOf)
+ENUM_DEFINE_TOSTRING_VIEW(POOLED, POOLED_ToStringView, POOLED_IndexOf)
+ENUM_DEFINE_TOSTRING_VIEW(POOLED_DENSE, POOLED_DENSE_ToStringView, POOLED_DENSE_IndexOf)
+ENUM_DEFINE_TOSTRING_VIEW(SOA, SOA_ToStringView, SOA_IndexOf)
+ENUM_DEFINE_TOSTRING_VIEW(SHARED, SHARED_ToStringView, SHARED_IndexOf)
+
+/**
+ * Non-zero if every element of @p e has a view equal to its ToString.
+ */
+#define VIEWS_MATCH(e, view, tostring, ok) \
+    do \
+    { \
+        size_t idx; \
+        \
+        (ok) = 1; \
+        for (idx = 0; idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL); ++idx) \
+        { \
+            struct Enum_StringView name = view(e##_ValueAt(idx)); \
+            \
+            (ok) = (ok) && name.ptr == tostring(e##_ValueAt(idx)) \
+                   && name.len == strlen(name.ptr) \
+                   && e##_NameLengthAt(idx) == strlen(e##_NameAt(idx)); \
+        } \
+    } while (0)
+
+/**
+ * Test string-view ToString over each table layout.
+ */
+static char* test_ToStringView(void)
+{
+    struct Enum_StringView name;
+    int ok;
+
+    VIEWS_MATCH(VS, VS_ToStringView, VS_ToString, ok);
+    mu_assert("test_ToStringView: VS views differ from ToString", ok);
+    VIEWS_MATCH(NONLITERAL, NONLITERAL_ToStringView, NONLITERAL_ToString, ok);
+    mu_assert("test_ToStringView: NONLITERAL views differ from ToString", ok);
+    VIEWS_MATCH(POOLED, POOLED_ToStringView, POOLED_ToString, ok);
+    mu_assert("test_ToStringView: POOLED views differ from ToString", ok);
+    VIEWS_MATCH(POOLED_DENSE, POOLED_DENSE_ToStringView, POOLED_DENSE_ToString, ok);
+    mu_assert("test_ToStringView: POOLED_DENSE views differ from ToString", ok);
+    VIEWS_MATCH(SOA, SOA_ToStringView, SOA_ToString, ok);
+    mu_assert("test_ToStringView: SOA views differ from ToString", ok);
+    VIEWS_MATCH(SHARED, SHARED_ToStringView, SHARED_ToString, ok);
+    mu_assert("test_ToStringView: SHARED views differ from ToString", ok);
+
+    name = VS_ToStringView(VS_BUG);
+    mu_assert("test_ToStringView: VS_BUG view not equal to 'VS 4'",
+              name.len == 4 && memcmp(name.ptr, "VS 4", 4) == 0);
+
+    name = NONLITERAL_ToStringView(NONLITERAL_B);
+    mu_assert("test_ToStringView: non-literal name view not equal to 'Not a literal'",
+              name.ptr == NONLITERAL_NAME && name.len == sizeof(NONLITERAL_NAME) - 1);
+
+    name = POOLED_DENSE_ToStringView(POOLED_DENSE_0);
+    mu_assert("test_ToStringView: empty name view not of length 0",
+              name.len == 0 && name.ptr[0] == '\0');
+
+    name = SOA_ToStringView((enum SOA) 41);
+    mu_assert("test_ToStringView: unknown view not equal to ENUM_UNKNOWN_STRING",
+              name.len == strlen(ENUM_UNKNOWN_STRING)
+              && strcmp(name.ptr, ENUM_UNKNOWN_STRING) == 0);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_FROMSTRING_TRIE tests
+ ***********************************/
+
+#define TRIE(_, _V, _S, _VS) \
+    _(TRIE_TRIANGLE) \
+    _(TRIE_TRIDENT) \
+    _(TRIE_SQUARE) \
+    _V(TRIE_SQUARE_ALIAS, TRIE_SQUARE) \
+    _(TRIE_Square) \
+    _(TRIE_TRIE) \
+    _(TRIE_CIRCLE) \
+    _V(TRIE_CIRCLE_ALIAS, TRIE_CIRCLE) \
+
+ENUM(TRIE);
+ENUM_IMPL(TRIE);
+ENUM_DEFINE_INDEXOF(TRIE, TRIE_IndexOf)
+ENUM_DEFINE_FROMSTRING_TRIE(TRIE, TRIE_FromExact, TRIE_IndexOf, 0)
+ENUM_DEFINE_FROMSTRING_TRIE(TRIE, TRIE_FromLoose, TRIE_IndexOf,
+                            ENUM_TRIE_FOLD_CASE | ENUM_TRIE_STRIP_PREFIX)
+ENUM_DEFINE_FROMSTRING_TRIE(TRIE, TRIE_FromAbbrev, TRIE_IndexOf,
+                            ENUM_TRIE_FOLD_CASE | ENUM_TRIE_STRIP_PREFIX | ENUM_TRIE_ABBREVIATE)
+ENUM_DEFINE_FROMSTRING_TRIE(SOA, SOA_FromTrie, SOA_HashIndexOf, ENUM_TRIE_STRIP_PREFIX)
+
+/**
+ * Test exact trie parsing matches FromString.
+ */
+static char* test_TrieExact(void)
+{
+    char const* missing[] = {"", "TRIE_", "TRIE_TRI", "TRIE_TRIANGLES", "trie_triangle", "TRIANGLE"};
+    size_t idx;
+
+    for (idx = 0; idx < sizeof(TRIE_IMPL)/sizeof(*TRIE_IMPL); ++idx)
+    {
+        enum TRIE literal = (enum TRIE) -1;
+
+        mu_assert("test_TrieExact: name not found",
+                  TRIE_FromExact(TRIE_NameAt(idx), strlen(TRIE_NameAt(idx)), &literal) == ENUM_OK
+                  && literal == TRIE_ValueAt(idx));
+    }
+
+    for (idx = 0; idx < sizeof(SOA_IMPL)/sizeof(*SOA_IMPL); ++idx)
+    {
+        enum SOA literal = (enum SOA) 1;
+
+        mu_assert("test_TrieExact: SOA name not found",
+                  SOA_FromTrie(SOA_NameAt(idx), strlen(SOA_NameAt(idx)), &literal) == ENUM_OK
+                  && literal == SOA_ValueAt(idx));
+    }
+
+    for (idx = 0; idx < sizeof(missing)/sizeof(*missing); ++idx)
+    {
+        enum TRIE literal = TRIE_TRIDENT;
+
+        mu_assert("test_TrieExact: missing name found",
+                  TRIE_FromExact(missing[idx], strlen(missing[idx]), &literal) != ENUM_OK
+                  && literal == TRIE_TRIDENT);
+    }
+
+    mu_assert("test_TrieExact: TRIE_TRI not ambiguous",
+              TRIE_FromExact("TRIE_TRI", 8, NULL) == ENUM_E_AMBIGUOUS);
+
+    return 0;
+}
+
+/**
+ * Test case folding, prefix stripping and abbreviation.
+ */
+static char* test_TrieLoose(void)
+{
+    char const* triangle[] = {"TRIE_TRIANGLE", "trie_triangle", "Triangle", "triangle", "TRIANGLE"};
+    enum TRIE literal = TRIE_TRIE;
+    size_t idx;
+
+    for (idx = 0; idx < sizeof(triangle)/sizeof(*triangle); ++idx)
+    {
+        literal = TRIE_TRIE;
+        mu_assert("test_TrieLoose: triangle spelling not found",
+                  TRIE_FromLoose(triangle[idx], strlen(triangle[idx]), &literal) == ENUM_OK
+                  && literal == TRIE_TRIANGLE);
+    }
+
+    mu_assert("test_TrieLoose: folded 'square' not the first declared",
+              TRIE_FromLoose("square", 6, &literal) == ENUM_OK && literal == TRIE_SQUARE);
+    mu_assert("test_TrieLoose: folded 'TRIE_Square' not the first declared",
+              TRIE_FromLoose("TRIE_Square", 11, &literal) == ENUM_OK && literal == TRIE_SQUARE);
+    mu_assert("test_TrieLoose: length not respected",
+              TRIE_FromLoose("tridentXYZ", 7, &literal) == ENUM_OK && literal == TRIE_TRIDENT);
+    mu_assert("test_TrieLoose: name without prefix not found",
+              TRIE_FromLoose("trie", 4, &literal) == ENUM_OK && literal == TRIE_TRIE);
+    mu_assert("test_TrieLoose: 'tri' not ambiguous",
+              TRIE_FromLoose("tri", 3, &literal) == ENUM_E_AMBIGUOUS);
+    mu_assert("test_TrieLoose: 'tria' found without ENUM_TRIE_ABBREVIATE",
+              TRIE_FromLoose("tria", 4, &literal) == ENUM_E_UNKNOWN);
+    mu_assert("test_TrieLoose: 'hexagon' found",
+              TRIE_FromLoose("hexagon", 7, &literal) == ENUM_E_UNKNOWN);
+
+    mu_assert("test_TrieLoose: 'tria' not abbreviated",
+              TRIE_FromAbbrev("tria", 4, &literal) == ENUM_OK && literal == TRIE_TRIANGLE);
+    mu_assert("test_TrieLoose: 'circ' not abbreviated, though all circles share a value",
+              TRIE_FromAbbrev("circ", 4, &literal) == ENUM_OK && literal == TRIE_CIRCLE);
+    mu_assert("test_TrieLoose: 'sq' not ambiguous, though SQUARE and Square differ",
+              TRIE_FromAbbrev("sq", 2, &literal) == ENUM_E_AMBIGUOUS);
+    mu_assert("test_TrieLoose: abbreviated 'tri' not ambiguous",
+              TRIE_FromAbbrev("tri", 3, &literal) == ENUM_E_AMBIGUOUS);
+    mu_assert("test_TrieLoose: abbreviated 'trie' not exact",
+              TRIE_FromAbbrev("trie", 4, &literal) == ENUM_OK && literal == TRIE_TRIE);
+    mu_assert("test_TrieLoose: empty string not ambiguous",
+              TRIE_FromAbbrev("", 0, &literal) == ENUM_E_UNKNOWN);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_ISVALID tests
+ ***********************************/
+
+ENUM_DEFINE_ISVALID(CONTIGUOUS, CONTIGUOUS_IsValid, CONTIGUOUS_IndexOf)
+ENUM_DEFINE_ISVALID(MONOTONIC, MONOTONIC_IsValid, MONOTONIC_AnyIndexOf)
+ENUM_DEFINE_ISVALID(SOA, SOA_IsValid, SOA_HashIndexOf)
+ENUM_DEFINE_ISVALID(WIDE, WIDE_IsValid, WIDE_IndexOf)
+ENUM_DEFINE_ISVALID_BATCH(WIDE, WIDE_IsValidBatch, WIDE_IsValid)
+ENUM_DEFINE_ISVALID_BATCH(SOA, SOA_IsValidBatch, SOA_IsValid)
+
+/**
+ * Sets @p ok to zero unless @p isvalid agrees with a linear search of
+ * @p e_IMPL for each value, its neighbours and far out of range values.
+ */
+#define ISVALID_MATCHES(e, isvalid, ok) \
+    do \
+    { \
+        size_t idx; \
+        int delta; \
+        \
+        (ok) = !isvalid(INT64_MIN) && !isvalid(INT64_MAX) \
+               && !isvalid(((int64_t) 1 << 32) + e##_ValueAt(0)) \
+               && !isvalid((int64_t) e##_ValueAt(0) - ((int64_t) 1 << 32)); \
+        for (idx = 0; idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL); ++idx) \
+        { \
+            for (delta = -1; delta <= 1; ++delta) \
+            { \
+                int64_t value = (int64_t) e##_ValueAt(idx) + delta; \
+                int found = 0; \
+                size_t other; \
+                \
+                for (other = 0; other < sizeof(e##_IMPL)/sizeof(*e##_IMPL); ++other) \
+                { \
+                    found |= (int64_t) e##_ValueAt(other) == value; \
+                } \
+                \
+                (ok) = (ok) && !isvalid(value) == !found; \
+            } \
+        } \
+    } while (0)
+
+/**
+ * Test IsValid with a bitmap and with an IndexOf function.
+ */
+static char* test_IsValid(void)
+{
+    int ok;
+
+    ISVALID_MATCHES(CONTIGUOUS, CONTIGUOUS_IsValid, ok);
+    mu_assert("test_IsValid: CONTIGUOUS validity differs from linear search", ok);
+    ISVALID_MATCHES(MONOTONIC, MONOTONIC_IsValid, ok);
+    mu_assert("test_IsValid: MONOTONIC validity differs from linear search", ok);
+    ISVALID_MATCHES(SOA, SOA_IsValid, ok);
+    mu_assert("test_IsValid: SOA validity differs from linear search", ok);
+    ISVALID_MATCHES(WIDE, WIDE_IsValid, ok);
+    mu_assert("test_IsValid: WIDE validity differs from linear search", ok);
+
+    mu_assert("test_IsValid: CONTIGUOUS does not use a bitmap", CONTIGUOUS_IsValid_BITMAP);
+    mu_assert("test_IsValid: WIDE does not use a bitmap", WIDE_IsValid_BITMAP);
+    mu_assert("test_IsValid: MONOTONIC uses a bitmap, though sparse", !MONOTONIC_IsValid_BITMAP);
+    mu_assert("test_IsValid: SOA uses a bitmap, though sparse", !SOA_IsValid_BITMAP);
+
+    return 0;
+}
+
+/**
+ * Test batch IsValid finds the first invalid value, in and after blocks.
+ */
+static char* test_IsValidBatch(void)
+{
+    int64_t in[21];
+    size_t n = sizeof(in)/sizeof(*in);
+    size_t bad;
+
+    for (bad = 0; bad < n; ++bad)
+    {
+        in[bad] = WIDE_ValueAt(bad);
+    }
+
+    mu_assert("test_IsValidBatch: valid values not all valid",
+              WIDE_IsValidBatch(in, n) == n && WIDE_IsValidBatch(in, 0) == 0);
+
+    for (bad = 0; bad < n; ++bad)
+    {
+        int64_t value = in[bad];
+
+        in[bad] = value + 1;
+        mu_assert("test_IsValidBatch: first invalid value not found",
+                  WIDE_IsValidBatch(in, n) == bad);
+        in[n - 1] = 95;
+        mu_assert("test_IsValidBatch: earlier of two invalid values not found",
+                  WIDE_IsValidBatch(in, n) == bad);
+        in[n - 1] = WIDE_ValueAt(n - 1);
+        in[bad] = value;
+    }
+
+    in[5] = INT64_MIN;
+    mu_assert("test_IsValidBatch: value below the bitmap span valid",
+              WIDE_IsValidBatch(in, n) == 5);
+    in[5] = INT64_MAX;
+    mu_assert("test_IsValidBatch: value above the bitmap span valid",
+              WIDE_IsValidBatch(in, n) == 5);
+
+    in[0] = SOA_INT_MIN;
+    in[1] = SOA_INT_MAX;
+    in[2] = (int64_t) SOA_INT_MAX + 1;
+    mu_assert("test_IsValidBatch: INT_MAX + 1 valid for SOA",
+              SOA_IsValidBatch(in, 3) == 2);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_LOOKUP tests
+ ***********************************/
+
+ENUM_TRAITS(CONTIGUOUS);
+ENUM_TRAITS(MONOTONIC);
+ENUM_TRAITS(SOA);
+ENUM_TRAITS(WIDE);
+
+ENUM_DEFINE_LOOKUP(CONTIGUOUS, CONTIGUOUS_Lookup)
+ENUM_DEFINE_LOOKUP(MONOTONIC, MONOTONIC_Lookup)
+ENUM_DEFINE_LOOKUP(SOA, SOA_Lookup)
+ENUM_DEFINE_LOOKUP(WIDE, WIDE_Lookup)
+ENUM_DEFINE_LOOKUP(SHARED, SHARED_Lookup)
+
+/* traits size arrays at file scope */
+static unsigned SHARED_BY_VALUE[ENUM_SPAN(SHARED)];
+static unsigned WIDE_BY_VALUE[ENUM_MAX_VALUE(WIDE) - ENUM_MIN_VALUE(WIDE) + 1];
+
+/**
+ * Sets @p ok to zero unless @p lookup agrees with @p indexof for each value
+ * and its neighbours.
+ */
+#define LOOKUP_MATCHES(e, lookup, indexof, ok) \
+    do \
+    { \
+        size_t idx; \
+        int delta; \
+        \
+        (ok) = 1; \
+        for (idx = 0; idx < sizeof(e##_IMPL)/sizeof(*e##_IMPL); ++idx) \
+        { \
+            for (delta = -1; delta <= 1; ++delta) \
+            { \
+                enum e value = (enum e) ((int64_t) e##_ValueAt(idx) + delta); \
+                \
+                (ok) &= lookup(value) == indexof(value); \
+            } \
+        } \
+    } while (0)
+
+/**
+ * Test the traits are constant expressions equal to the enums' shapes.
+ */
+static char* test_Traits(void)
+{
+    mu_assert("test_Traits: SHARED span not equal to 11",
+              ENUM_SPAN(SHARED) == 11
+              && sizeof(SHARED_BY_VALUE) / sizeof(*SHARED_BY_VALUE) == 11);
+    mu_assert("test_Traits: WIDE range not [-99, 96]",
+              ENUM_MIN_VALUE(WIDE) == -99 && ENUM_MAX_VALUE(WIDE) == 96
+              && sizeof(WIDE_BY_VALUE) / sizeof(*WIDE_BY_VALUE) == 196);
+    mu_assert("test_Traits: SOA range not [INT_MIN, INT_MAX]",
+              ENUM_MIN_VALUE(SOA) == INT_MIN && ENUM_MAX_VALUE(SOA) == INT_MAX
+              && ENUM_SPAN(SOA) == 1LL << 32);
+
+    mu_assert("test_Traits: CONTIGUOUS lookup not contiguous",
+              ENUM_LOOKUP_MODE_OF(CONTIGUOUS) == ENUM_LOOKUP_CONTIGUOUS);
+    mu_assert("test_Traits: SHARED lookup not dense",
+              ENUM_IS_DENSE(SHARED) && ENUM_LOOKUP_MODE_OF(SHARED) == ENUM_LOOKUP_DENSE);
+    mu_assert("test_Traits: WIDE lookup not dense",
+              ENUM_LOOKUP_MODE_OF(WIDE) == ENUM_LOOKUP_DENSE);
+    mu_assert("test_Traits: MONOTONIC lookup not binary search",
+              !ENUM_IS_DENSE(MONOTONIC) && ENUM_LOOKUP_MODE_OF(MONOTONIC) == ENUM_LOOKUP_BINARY);
+    mu_assert("test_Traits: SOA lookup not hashed",
+              ENUM_LOOKUP_MODE_OF(SOA) == ENUM_LOOKUP_HASH);
+
+    return 0;
+}
+
+/**
+ * Test every lookup mode returns the same iterators as IndexOf, including
+ * for aliases and unknown values.
+ */
+static char* test_Lookup(void)
+{
+    int ok = 0;
+
+    LOOKUP_MATCHES(CONTIGUOUS, CONTIGUOUS_Lookup, CONTIGUOUS_IndexOf, ok);
+    mu_assert("test_Lookup: contiguous lookup differs from IndexOf", ok);
+    LOOKUP_MATCHES(MONOTONIC, MONOTONIC_Lookup, MONOTONIC_AnyIndexOf, ok);
+    mu_assert("test_Lookup: binary search lookup differs from IndexOf", ok);
+    LOOKUP_MATCHES(SOA, SOA_Lookup, SOA_HashIndexOf, ok);
+    mu_assert("test_Lookup: hashed lookup differs from IndexOf", ok);
+    LOOKUP_MATCHES(WIDE, WIDE_Lookup, WIDE_IndexOf, ok);
+    mu_assert("test_Lookup: dense lookup differs from IndexOf", ok);
+    LOOKUP_MATCHES(SHARED, SHARED_Lookup, SHARED_IndexOf, ok);
+    mu_assert("test_Lookup: dense lookup with aliases differs from IndexOf", ok);
+
+    mu_assert("test_Lookup: Lookup(SHARED_5_ALIAS) not the first element",
+              SHARED_Lookup(SHARED_5_ALIAS) == 0);
+    mu_assert("test_Lookup: unknown dense value has an index",
+              WIDE_Lookup((enum WIDE) 95) == ENUM_INDEX_UNKNOWN
+              && WIDE_Lookup((enum WIDE) 97) == ENUM_INDEX_UNKNOWN
+              && WIDE_Lookup((enum WIDE) INT_MIN) == ENUM_INDEX_UNKNOWN);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_COUNTER tests
+ ***********************************/
+
+ENUM_DECLARE_COUNTER(SOA, SoaCounter, 3);
+ENUM_DEFINE_COUNTER(SOA, SoaCounter, SOA_HashIndexOf, SOA_IteratorBegin, SOA_IteratorEnd)
+
+ENUM_DECLARE_COUNTER(WIDE, WideCounter, 2);
+ENUM_DEFINE_COUNTER(WIDE, WideCounter, WIDE_IndexOf, WIDE_IteratorBegin, WIDE_IteratorEnd)
+
+/**
+ * Test shards are padded to whole cache lines and sum to the totals.
+ */
+static char* test_Counter(void)
+{
+    static SoaCounter_t counter;
+    uint64_t totals[ENUM_COUNT(SOA)];
+
+    mu_assert("test_Counter: shard not padded to whole cache lines",
+              sizeof(counter.shard[0]) % ENUM_CACHE_LINE == 0
+              && sizeof(counter.shard[0].counts) / sizeof(uint64_t) >= ENUM_COUNT(SOA));
+
+    mu_assert("test_Counter: Increment(SOA_INT_MIN) failed",
+              SoaCounter_Increment(&counter, 0, SOA_INT_MIN) == ENUM_OK);
+    mu_assert("test_Counter: Add(SOA_INT_MIN) failed",
+              SoaCounter_Add(&counter, 2, SOA_INT_MIN, 41) == ENUM_OK);
+    mu_assert("test_Counter: Increment of an unknown value succeeded",
+              SoaCounter_Increment(&counter, 1, (enum SOA) 8) == ENUM_E_UNKNOWN);
+    SoaCounter_Increment(&counter, 1, SOA_7_ALIAS);
+    SoaCounter_Increment(&counter, 2, SOA_7);
+
+    mu_assert("test_Counter: shards not kept apart",
+              counter.shard[0].counts[9] == 1 && counter.shard[1].counts[9] == 0
+              && counter.shard[2].counts[9] == 41);
+    mu_assert("test_Counter: Get(SOA_INT_MIN) not summed over shards",
+              SoaCounter_Get(&counter, SOA_INT_MIN) == 42);
+    mu_assert("test_Counter: SOA_7_ALIAS does not share the count of SOA_7",
+              SoaCounter_Get(&counter, SOA_7_ALIAS) == 2);
+    mu_assert("test_Counter: Get of an unknown value not zero",
+              SoaCounter_Get(&counter, (enum SOA) 8) == 0);
+
+    SoaCounter_Aggregate(&counter, totals);
+    mu_assert("test_Counter: Aggregate not indexed by iterator",
+              totals[9] == 42 && totals[4] == 2 && totals[0] == 0);
+    mu_assert("test_Counter: Aggregate of SOA_7_ALIAS not the count of SOA_7",
+              totals[7] == 2);
+
+    return 0;
+}
+
+/**
+ * Test aggregation across the cache lines of a shard.
+ */
+static char* test_CounterAggregate(void)
+{
+    static WideCounter_t counter;
+    uint64_t totals[ENUM_COUNT(WIDE)];
+    WIDE_Iterator_t iter;
+    int ok = 1;
+
+    mu_assert("test_CounterAggregate: shard not over several cache lines",
+              sizeof(counter.shard[0]) > ENUM_CACHE_LINE);
+
+    for (iter = WIDE_IteratorBegin(); iter <= WIDE_IteratorEnd(); iter++)
+    {
+        WideCounter_Add(&counter, (size_t) iter % 2, WIDE_IteratorToValue(iter), (uint64_t) iter);
+        WideCounter_Increment(&counter, 1, WIDE_IteratorToValue(iter));
+    }
+
+    WideCounter_Aggregate(&counter, totals);
+    for (iter = WIDE_IteratorBegin(); iter <= WIDE_IteratorEnd(); iter++)
+    {
+        ok &= totals[iter] == (uint64_t) iter + 1
+              && WideCounter_Get(&counter, WIDE_IteratorToValue(iter)) == (uint64_t) iter + 1;
+    }
+    mu_assert("test_CounterAggregate: totals not equal to the counts added", ok);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_PACKED tests
+ ***********************************/
+
+ENUM_DECLARE_PACKED(WIDE, WidePacked);
+ENUM_DEFINE_PACKED(WIDE, WidePacked, WIDE_IndexOf)
+
+ENUM_DECLARE_PACKED(SOA, SoaPacked);
+ENUM_DEFINE_PACKED(SOA, SoaPacked, SOA_HashIndexOf)
+
+/**
+ * Test the element width follows the member count, and get and set
+ * across word boundaries.
+ */
+static char* test_Packed(void)
+{
+    uint64_t words[ENUM_PACKED_WORDS(SOA, 40)];
+    enum SOA in[40];
+    SoaPacked_t packed;
+    size_t idx;
+    int ok = 1;
+
+    mu_assert("test_Packed: WIDE not packed in 7 bits, 9 to a word",
+              ENUM_PACKED_BITS(WIDE) == 7 && ENUM_PACKED_PER_WORD(WIDE) == 9);
+    mu_assert("test_Packed: SOA not packed in 4 bits, 16 to a word",
+              ENUM_PACKED_BITS(SOA) == 4 && ENUM_PACKED_PER_WORD(SOA) == 16);
+    mu_assert("test_Packed: 40 SOA values not held in 3 words",
+              sizeof(words) == 3 * sizeof(uint64_t));
+
+    memset(words, 0xA5, sizeof(words));
+    SoaPacked_Init(&packed, words, sizeof(words) / sizeof(*words));
+    mu_assert("test_Packed: capacity not equal to 48",
+              packed.capacity == 48 && packed.length == 0);
+
+    for (idx = 0; idx < 40; ++idx)
+    {
+        in[idx] = SOA_ValueAt(idx * 7 % ENUM_COUNT(SOA));
+    }
+    mu_assert("test_Packed: Append of 40 values failed",
+              SoaPacked_Append(&packed, in, 40) == 40 && packed.length == 40);
+
+    for (idx = 0; idx < 40; ++idx)
+    {
+        ok &= SoaPacked_Get(&packed, idx) == in[idx];
+    }
+    mu_assert("test_Packed: Get differs from the appended values", ok);
+
+    mu_assert("test_Packed: Set(15, SOA_INT_MAX) failed",
+              SoaPacked_Set(&packed, 15, SOA_INT_MAX) == ENUM_OK);
+    mu_assert("test_Packed: Set(16, SOA_INT_MIN) failed",
+              SoaPacked_Set(&packed, 16, SOA_INT_MIN) == ENUM_OK);
+    mu_assert("test_Packed: Set across a word boundary clobbered a neighbour",
+              SoaPacked_Get(&packed, 14) == in[14] && SoaPacked_Get(&packed, 15) == SOA_INT_MAX
+              && SoaPacked_Get(&packed, 16) == SOA_INT_MIN && SoaPacked_Get(&packed, 17) == in[17]);
+    mu_assert("test_Packed: Set of an unknown value succeeded",
+              SoaPacked_Set(&packed, 15, (enum SOA) 8) == ENUM_E_UNKNOWN
+              && SoaPacked_Get(&packed, 15) == SOA_INT_MAX);
+
+    SoaPacked_Set(&packed, 0, SOA_7_ALIAS);
+    mu_assert("test_Packed: SOA_7_ALIAS not stored as SOA_7",
+              SoaPacked_Get(&packed, 0) == SOA_7);
+
+    return 0;
+}
+
+/**
+ * Test bulk append stops at unknown values and capacity, and decode from
+ * any offset.
+ */
+static char* test_PackedDecode(void)
+{
+    uint64_t words[ENUM_PACKED_WORDS(WIDE, 99)];
+    enum WIDE in[100];
+    enum WIDE out[100];
+    WidePacked_t packed;
+    size_t idx;
+    int ok = 1;
+
+    WidePacked_Init(&packed, words, sizeof(words) / sizeof(*words));
+    for (idx = 0; idx < 100; ++idx)
+    {
+        /* runs of three */
+        in[idx] = WIDE_ValueAt(idx / 3 * 5 % ENUM_COUNT(WIDE));
+    }
+
+    in[50] = (enum WIDE) 1;
+    mu_assert("test_PackedDecode: Append did not stop at an unknown value",
+              WidePacked_Append(&packed, in, 100) == 50 && packed.length == 50);
+    mu_assert("test_PackedDecode: Append did not stop at capacity",
+              packed.capacity == 99
+              && WidePacked_Append(&packed, in + 51, 49) == 49 && packed.length == 99
+              && WidePacked_Append(&packed, in, 1) == 0);
+
+    mu_assert("test_PackedDecode: Decode from 0 not the full length",
+              WidePacked_Decode(&packed, 0, 100, out) == 99);
+    for (idx = 0; idx < 99; ++idx)
+    {
+        ok &= out[idx] == in[idx < 50 ? idx : idx + 1];
+    }
+    mu_assert("test_PackedDecode: decoded values differ", ok);
+
+    mu_assert("test_PackedDecode: Decode from mid-word differs",
+              WidePacked_Decode(&packed, 13, 7, out) == 7 && out[0] == in[13] && out[6] == in[19]);
+    mu_assert("test_PackedDecode: Decode past the end not clamped",
+              WidePacked_Decode(&packed, 95, 10, out) == 4 && out[3] == in[99]
+              && WidePacked_Decode(&packed, 99, 1, out) == 0
+              && WidePacked_Decode(&packed, 200, 1, out) == 0);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_DEFINE_CODEC tests
+ ***********************************/
+
+ENUM_DECLARE_CODEC(WIDE, WideCodec);
+ENUM_DEFINE_CODEC(WIDE, WideCodec, WIDE_IndexOf)
+
+ENUM_DECLARE_CODEC(SOA, SoaCodec);
+ENUM_DEFINE_CODEC(SOA, SoaCodec, SOA_HashIndexOf)
+
+/**
+ * Encodes @p n values from @p in to @p buf, @p chunk bytes per call, and
+ * returns the stream length.
+ */
+static size_t WideCodec_EncodeAll(enum WIDE const* in, size_t n, uint8_t* buf, size_t chunk)
+{
+    struct Enum_Encoder enc;
+    size_t length = 0;
+    size_t consumed = 0;
+    size_t written = 0;
+
+    Enum_EncoderInit(&enc);
+    while (n > 0)
+    {
+        WideCodec_Encode(&enc, in, n, &consumed, buf + length, chunk, &written);
+        in += consumed;
+        n -= consumed;
+        length += written;
+    }
+
+    while (WideCodec_Flush(&enc, buf + length, chunk, &written) > 0)
+    {
+        length += written;
+    }
+
+    return length + written;
+}
+
+/**
+ * Test a stream of runs and literals survives round trips through buffers
+ * of any size, and that each block takes its shortest form.
+ */
+static char* test_Codec(void)
+{
+    static enum WIDE in[2000];
+    static enum WIDE out[2000];
+    static uint8_t buf[4000];
+    size_t lengths[3];
+    size_t chunks[3] = {1, 7, sizeof(buf)};
+    size_t idx;
+    size_t chunk;
+    int ok = 1;
+
+    for (idx = 0; idx < 2000; ++idx)
+    {
+        /* a long run, short runs, then a literal ramp */
+        in[idx] = WIDE_ValueAt(idx < 1000 ? 3 : idx < 1500 ? idx / 3 % 7 : idx % ENUM_COUNT(WIDE));
+    }
+
+    for (chunk = 0; chunk < 3; ++chunk)
+    {
+        struct Enum_Decoder dec;
+        size_t length = 0;
+        size_t done = 0;
+        size_t written = 0;
+
+        lengths[chunk] = WideCodec_EncodeAll(in, 2000, buf, chunks[chunk]);
+
+        Enum_DecoderInit(&dec);
+        /* packed bytes can hold more values than fit the output, so run until it stalls */
+        do
+        {
+            size_t avail = lengths[chunk] - length < chunks[chunk] ? lengths[chunk] - length : chunks[chunk];
+            size_t consumed = 0;
+
+            written = 0;
+            ok &= WideCodec_Decode(&dec, buf + length, avail, &consumed,
+                                   out + done, chunks[chunk] < 2000 - done ? chunks[chunk] : 2000 - done,
+                                   &written) == ENUM_OK;
+            length += consumed;
+            done += written;
+        } while (done < 2000 && (written > 0 || length < lengths[chunk]));
+
+        ok &= done == 2000 && memcmp(in, out, sizeof(in)) == 0;
+    }
+
+    mu_assert("test_Codec: round trip differs", ok);
+    mu_assert("test_Codec: stream length depends on the buffer size",
+              lengths[0] == lengths[1] && lengths[1] == lengths[2]);
+
+    /* a run block, 1000 = 0x3e8 << 2 | 2 in two varint bytes, and index 3 */
+    mu_assert("test_Codec: long run not a run block",
+              buf[0] == ((0xfa2 & 0x7f) | 0x80) && buf[1] == 0xfa2 >> 7 && buf[2] == 3);
+    /* 7-bit indices below 128 are shorter packed than as varints */
+    mu_assert("test_Codec: literals not packed",
+              (buf[3] & 3) == ENUM_CODEC_PACKED);
+    mu_assert("test_Codec: stream not under a byte per value",
+              lengths[2] < 1000);
+
+    return 0;
+}
+
+/**
+ * Test unknown values are refused by the encoder, and corrupt input is
+ * reported by the decoder rather than decoded.
+ */
+static char* test_CodecErrors(void)
+{
+    enum SOA in[5] = {SOA_7, SOA_7_ALIAS, SOA_INT_MIN, (enum SOA) 8, SOA_2};
+    enum SOA out[8];
+    uint8_t buf[64];
+    /* varint block of index 11, then index 12 of 12 elements */
+    uint8_t const unknown[] = {2 << 2 | ENUM_CODEC_VARINT, 11, 12};
+    /* mode 3 */
+    uint8_t const bad_mode[] = {1 << 2 | 3, 0};
+    /* a ten byte varint whose last byte, at shift 63, holds more than one bit */
+    uint8_t const overflow[] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f};
+    struct Enum_Encoder enc;
+    struct Enum_Decoder dec;
+    size_t consumed = 0;
+    size_t written = 0;
+    size_t length = 0;
+
+    Enum_EncoderInit(&enc);
+    mu_assert("test_CodecErrors: Encode of an unknown value succeeded",
+              SoaCodec_Encode(&enc, in, 5, &consumed, buf, sizeof(buf), &written) == ENUM_E_UNKNOWN
+              && consumed == 3);
+    length = written;
+    mu_assert("test_CodecErrors: Flush did not complete",
+              SoaCodec_Flush(&enc, buf + length, sizeof(buf) - length, &written) == 0);
+    length += written;
+
+    Enum_DecoderInit(&dec);
+    mu_assert("test_CodecErrors: Decode of the valid prefix failed",
+              SoaCodec_Decode(&dec, buf, length, &consumed, out, 8, &written) == ENUM_OK
+              && consumed == length && written == 3);
+    mu_assert("test_CodecErrors: SOA_7_ALIAS not decoded as SOA_7",
+              out[0] == SOA_7 && out[1] == SOA_7 && out[2] == SOA_INT_MIN);
+
+    Enum_DecoderInit(&dec);
+    mu_assert("test_CodecErrors: out of range index decoded",
+              SoaCodec_Decode(&dec, unknown, sizeof(unknown), &consumed, out, 8, &written) == ENUM_E_UNKNOWN
+              && written == 1 && out[0] == SOA_2);
+
+    Enum_DecoderInit(&dec);
+    mu_assert("test_CodecErrors: unknown block mode decoded",
+              SoaCodec_Decode(&dec, bad_mode, sizeof(bad_mode), &consumed, out, 8, &written) == ENUM_E_SYNTAX
+              && written == 0);
+
+    Enum_DecoderInit(&dec);
+    mu_assert("test_CodecErrors: overlong varint decoded",
+              SoaCodec_Decode(&dec, overflow, sizeof(overflow), &consumed, out, 8, &written) == ENUM_E_SYNTAX);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_TYPED tests
+ ***********************************/
+
+#define TYPED(_, _V, _S, _VS) \
+    _V(TYPED_IDLE, 0) \
+    _(TYPED_BUSY) \
+    _S(TYPED_DONE, "Typed Done") \
+    _V(TYPED_LAST, 255) \
+
+ENUM_TYPED(TYPED, uint8_t);
+ENUM_TRAITS(TYPED);
+
+/* six fields of a compact record */
+struct TypedRecord
+{
+    TYPED_Storage_t fields[6];
+};
+
+/**
+ * Test typed storage is the size of its type and converts losslessly.
+ */
+static char* test_Typed(void)
+{
+    struct TypedRecord record;
+
+    mu_assert("test_Typed: storage not one byte",
+              sizeof(TYPED_Storage_t) == 1 && sizeof(record) == 6);
+
+    record.fields[0] = TYPED_ToStorage(TYPED_LAST);
+    record.fields[5] = TYPED_ToStorage(TYPED_BUSY);
+    mu_assert("test_Typed: stored values not converted back",
+              TYPED_FromStorage(record.fields[0]) == TYPED_LAST
+              && TYPED_FromStorage(record.fields[5]) == TYPED_BUSY
+              && record.fields[0] == 255);
+
+    mu_assert("test_Typed: fits not checked for sign and width",
+              ENUM_STORAGE_FITS(uint8_t, 255) && !ENUM_STORAGE_FITS(uint8_t, 256)
+              && !ENUM_STORAGE_FITS(uint8_t, -1) && !ENUM_STORAGE_FITS(uint64_t, -1)
+              && ENUM_STORAGE_FITS(int8_t, -128) && !ENUM_STORAGE_FITS(int8_t, 128));
+
+    mu_assert("test_Typed: smallest storage of TYPED not 1 byte",
+              ENUM_STORAGE_BYTES(TYPED) == 1);
+    mu_assert("test_Typed: smallest storage of SHARED, WIDE not 1 byte",
+              ENUM_STORAGE_BYTES(SHARED) == 1 && ENUM_STORAGE_BYTES(WIDE) == 1);
+    mu_assert("test_Typed: smallest storage of MONOTONIC not 2 bytes",
+              ENUM_STORAGE_BYTES(MONOTONIC) == 2);
+    mu_assert("test_Typed: smallest storage of SOA, SHARED_INT not 4 bytes",
+              ENUM_STORAGE_BYTES(SOA) == 4 && ENUM_STORAGE_BYTES(SHARED_INT) == 4);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_IMPL_HOT_COLD tests
+ ***********************************/
+
+#define HOTCOLD(_, _V, _S, _VS) \
+    _V(HOTCOLD_10, 10) \
+    _(HOTCOLD_11) \
+    _S(HOTCOLD_12, "Hot cold twelve, a long description") \
+    _VS(HOTCOLD_3, 3, "Hot cold three") \
+    _VS(HOTCOLD_3_ALIAS, 3, "Hot cold three alias") \
+
+ENUM(HOTCOLD);
+ENUM_IMPL_HOT_COLD(HOTCOLD);
+ENUM_DEFINE_TOSTRING(HOTCOLD, HOTCOLD_ToString)
+ENUM_DEFINE_FROMSTRING(HOTCOLD, HOTCOLD_FromString)
+ENUM_DEFINE_INDEXOF(HOTCOLD, HOTCOLD_IndexOf)
+ENUM_DEFINE_DESCRIPTION(HOTCOLD, HOTCOLD_Describe, HOTCOLD_IndexOf)
+
+/**
+ * Test names come from the hot pool and descriptions from the cold one.
+ */
+static char* test_HotCold(void)
+{
+    char const* cold = (char const*) &HOTCOLD_DESCRIPTIONS;
+    char const* description = HOTCOLD_DescriptionAt(2);
+    enum HOTCOLD value = HOTCOLD_10;
+
+    mu_assert("test_HotCold: ToString(HOTCOLD_12) not the symbolic name",
+              strcmp(HOTCOLD_ToString(HOTCOLD_12), "HOTCOLD_12") == 0
+              && HOTCOLD_NameLengthAt(2) == 10);
+    mu_assert("test_HotCold: Describe(HOTCOLD_12) not the description",
+              strcmp(HOTCOLD_Describe(HOTCOLD_12), "Hot cold twelve, a long description") == 0
+              && HOTCOLD_DescriptionLengthAt(2) == 35);
+    mu_assert("test_HotCold: description not in the cold pool",
+              description > cold && description < cold + sizeof(HOTCOLD_DESCRIPTIONS));
+    mu_assert("test_HotCold: description text in the hot pool",
+              sizeof(HOTCOLD_NAMES) == sizeof("HOTCOLD_10HOTCOLD_11HOTCOLD_12HOTCOLD_3HOTCOLD_3_ALIAS") + 4);
+
+    mu_assert("test_HotCold: Describe(HOTCOLD_11) not the symbolic name",
+              strcmp(HOTCOLD_Describe(HOTCOLD_11), "HOTCOLD_11") == 0
+              && HOTCOLD_DescriptionLengthAt(1) == 10);
+    mu_assert("test_HotCold: Describe(HOTCOLD_3_ALIAS) not the first description",
+              strcmp(HOTCOLD_Describe(HOTCOLD_3_ALIAS), "Hot cold three") == 0
+              && strcmp(HOTCOLD_DescriptionAt(4), "Hot cold three alias") == 0);
+    mu_assert("test_HotCold: Describe of an unknown value not unknown",
+              strcmp(HOTCOLD_Describe((enum HOTCOLD) 4), ENUM_UNKNOWN_STRING) == 0);
+
+    mu_assert("test_HotCold: FromString(\"HOTCOLD_3\") failed",
+              HOTCOLD_FromString("HOTCOLD_3", 9, &value) == ENUM_OK && value == HOTCOLD_3);
+
+    return 0;
+}
+
+/***********************************
+ * ENUM_IMPL_PREFIX tests
+ ***********************************/
+
+#define PREFIXED_SUFFIXES(_, _V, _S, _VS) \
+    _V(SQUARE, 5) \
+    _(PENTAGON) \
+    _S(HEXAGON, "Six sides") \
+    _VS(404, 404, "Not found") \
+    _V(200, 200) \
+
+#define PREFIXED(_, _V, _S, _VS) ENUM_PREFIX_LIST(PREFIXED_, PREFIXED_SUFFIXES, _, _V, _S, _VS)
+
+ENUM(PREFIXED);
+ENUM_IMPL_PREFIX(PREFIXED, PREFIXED_, PREFIXED_SUFFIXES);
+ENUM_DEFINE_TOSTRING(PREFIXED, PREFIXED_ToString)
+ENUM_DEFINE_TOSTRING_SWITCH(PREFIXED, PREFIXED_ToStringSwitch)
+ENUM_DEFINE_INDEXOF(PREFIXED, PREFIXED_IndexOf)
+ENUM_DEFINE_TOSTRING_FULL(PREFIXED, PREFIXED_ToFullString, PREFIXED_IndexOf)
+ENUM_DEFINE_FROMSTRING(PREFIXED, PREFIXED_FromShortString)
+ENUM_DEFINE_FROMSTRING_PREFIX(PREFIXED, PREFIXED_FromString, PREFIXED_FromShortString)
+
+/**
+ * Test the list has the full names, and the table only the suffixes.
+ */
+static char* test_Prefix(void)
+{
+    enum PREFIXED value = PREFIXED_SQUARE;
+    char buf[16];
+
+    mu_assert("test_Prefix: list elements not prefixed",
+              PREFIXED_SQUARE == 5 && PREFIXED_PENTAGON == 6 && PREFIXED_HEXAGON == 7
+              && PREFIXED_404 == 404 && PREFIXED_200 == 200 && ENUM_COUNT(PREFIXED) == 5);
+    mu_assert("test_Prefix: ENUM_IMPL names of the list not full",
+              strcmp(PREFIXED_ToStringSwitch(PREFIXED_PENTAGON), "PREFIXED_PENTAGON") == 0);
+
+    mu_assert("test_Prefix: ToString not the suffix",
+              strcmp(PREFIXED_ToString(PREFIXED_PENTAGON), "PENTAGON") == 0
+              && strcmp(PREFIXED_ToString(PREFIXED_200), "200") == 0
+              && PREFIXED_NameLengthAt(4) == 3);
+    mu_assert("test_Prefix: ToString not the description",
+              strcmp(PREFIXED_ToString(PREFIXED_404), "Not found") == 0);
+    mu_assert("test_Prefix: prefix not stored once",
+              sizeof(PREFIXED_POOL) == sizeof("SQUAREPENTAGONSix sidesNot found200") + 4
+              && strcmp(PREFIXED_PREFIX, "PREFIXED_") == 0);
+
+    mu_assert("test_Prefix: ToFullString(PREFIXED_SQUARE) not the full name",
+              PREFIXED_ToFullString(PREFIXED_SQUARE, buf, sizeof(buf)) == 15
+              && strcmp(buf, "PREFIXED_SQUARE") == 0);
+    mu_assert("test_Prefix: ToFullString(PREFIXED_HEXAGON) not the description",
+              PREFIXED_ToFullString(PREFIXED_HEXAGON, buf, sizeof(buf)) == 9
+              && strcmp(buf, "Six sides") == 0);
+    mu_assert("test_Prefix: ToFullString(PREFIXED_PENTAGON) not truncated",
+              PREFIXED_ToFullString(PREFIXED_PENTAGON, buf, sizeof(buf)) == 17
+              && strcmp(buf, "PREFIXED_PENTAG") == 0);
+    mu_assert("test_Prefix: ToFullString of an unknown value not unknown",
+              PREFIXED_ToFullString((enum PREFIXED) 4, buf, sizeof(buf)) == sizeof(ENUM_UNKNOWN_STRING) - 1);
+
+    mu_assert("test_Prefix: FromString(\"PREFIXED_PENTAGON\") failed",
+              PREFIXED_FromString("PREFIXED_PENTAGON", 17, &value) == ENUM_OK && value == PREFIXED_PENTAGON);
+    mu_assert("test_Prefix: FromString(\"200\") failed",
+              PREFIXED_FromString("200", 3, &value) == ENUM_OK && value == PREFIXED_200);
+    mu_assert("test_Prefix: FromString(\"Six sides\") failed",
+              PREFIXED_FromString("Six sides", 9, &value) == ENUM_OK && value == PREFIXED_HEXAGON);
+    mu_assert("test_Prefix: FromString(\"PREFIXED_\") not unknown",
+              PREFIXED_FromString("PREFIXED_", 9, &value) == ENUM_E_UNKNOWN && value == PREFIXED_HEXAGON);
+
+    return 0;
+}
+
 /********************************/
 char* test_enum(void)
 {
@@ -625,6 +2569,131 @@ char* test_enum(void)
     mu_run_test(test_Iterator);
     mu_run_test(test_ReverseIterator);
 
+    /*
+     * ENUM_DEFINE_TOSTRING_SWITCH tests
+     */
+    mu_run_test(test_SwitchToString);
+
+    /*
+     * ENUM_DEFINE_FROMSTRING tests
+     */
+    mu_run_test(test_FromString);
+    mu_run_test(test_FromStringLength);
+
+    /*
+     * ENUM_DEFINE_TOSTRING_CONTIGUOUS tests
+     */
+    mu_run_test(test_IsContiguous);
+    mu_run_test(test_ContiguousToString);
+    mu_run_test(test_ContiguousToStringUnknown);
+
+    /*
+     * ENUM_DEFINE_*_MONOTONIC tests
+     */
+    mu_run_test(test_IsMonotonic);
+    mu_run_test(test_MonotonicToString);
+    mu_run_test(test_MonotonicIndexOf);
+
+    /*
+     * ENUM_IMPL_POOL tests
+     */
+    mu_run_test(test_PoolToString);
+    mu_run_test(test_PoolSize);
+
+    /*
+     * ENUM_IMPL_SOA tests
+     */
+    mu_run_test(test_SoaToString);
+
+    /*
+     * ENUM_DEFINE_*_BATCH tests
+     */
+    mu_run_test(test_MonotonicBatch);
+    mu_run_test(test_SoaBatch);
+
+    /*
+     * ENUM_DEFINE_FLAGS_* tests
+     */
+    mu_run_test(test_FlagsToString);
+    mu_run_test(test_FlagsToStringTruncated);
+    mu_run_test(test_FlagsFromString);
+
+    /*
+     * ENUM_DEFINE_INDEXOF tests
+     */
+    mu_run_test(test_IndexOf);
+
+    /*
+     * ENUM_DEFINE_MAP tests
+     */
+    mu_run_test(test_Map);
+
+    /*
+     * ENUM_DEFINE_SET tests
+     */
+    mu_run_test(test_Set);
+    mu_run_test(test_SetIteration);
+
+    /*
+     * ENUM_DECLARE_IMPL / ENUM_DEFINE_IMPL tests
+     */
+    mu_run_test(test_SharedImpl);
+
+    /*
+     * ENUM_DEFINE_TOSTRING_VIEW tests
+     */
+    mu_run_test(test_ToStringView);
+
+    /*
+     * ENUM_DEFINE_FROMSTRING_TRIE tests
+     */
+    mu_run_test(test_TrieExact);
+    mu_run_test(test_TrieLoose);
+
+    /*
+     * ENUM_DEFINE_ISVALID tests
+     */
+    mu_run_test(test_IsValid);
+    mu_run_test(test_IsValidBatch);
+
+    /*
+     * ENUM_DEFINE_LOOKUP tests
+     */
+    mu_run_test(test_Traits);
+    mu_run_test(test_Lookup);
+
+    /*
+     * ENUM_DEFINE_COUNTER tests
+     */
+    mu_run_test(test_Counter);
+    mu_run_test(test_CounterAggregate);
+
+    /*
+     * ENUM_DEFINE_PACKED tests
+     */
+    mu_run_test(test_Packed);
+    mu_run_test(test_PackedDecode);
+
+    /*
+     * ENUM_DEFINE_CODEC tests
+     */
+    mu_run_test(test_Codec);
+    mu_run_test(test_CodecErrors);
+
+    /*
+     * ENUM_TYPED tests
+     */
+    mu_run_test(test_Typed);
+
+    /*
+     * ENUM_IMPL_HOT_COLD tests
+     */
+    mu_run_test(test_HotCold);
+
+    /*
+     * ENUM_IMPL_PREFIX tests
+     */
+    mu_run_test(test_Prefix);
 
     return 0;
 }
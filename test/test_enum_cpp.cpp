@@ -0,0 +1,142 @@
+/*
+ * Tests constexpr C++ enum tables.
+ */
+
+#include "minunit.h"
+#include <cstring>
+
+#include "enum.hpp"
+
+extern "C" char* test_enum_cpp(void);
+
+/***********************************
+ * ENUM_IMPL_CONSTEXPR tests
+ ***********************************/
+
+#define VS(_, _V, _S, _VS) \
+    _(VS_0) \
+    _V(VS_1, 1) \
+    _S(VS_2, "VS 2") \
+    _VS(VS_4, 4, "VS 4") \
+    _VS(VS_BUG, 4, "Bug") \
+
+ENUM(VS);
+ENUM_IMPL_CONSTEXPR(VS);
+ENUM_IMPL(VS);
+ENUM_DEFINE_TOSTRING(VS, VS_ToString)
+ENUM_DEFINE_FROMSTRING(VS, VS_FromString)
+
+static_assert(cenum::count<enum VS> == 5, "VS has 5 elements");
+static_assert(cenum::values<enum VS>[3] == VS_4, "VS_4 is the fourth element");
+static_assert(cenum::to_string(VS_0) == "VS_0", "ToString(VS_0) is 'VS_0'");
+static_assert(cenum::to_string(VS_2) == "VS 2", "ToString(VS_2) is 'VS 2'");
+static_assert(cenum::to_string(VS_BUG) == "VS 4", "Duplicates find the first element");
+static_assert(cenum::to_string(static_cast<enum VS>(3)) == ENUM_UNKNOWN_STRING, "3 is unknown");
+static_assert(*cenum::from_string<enum VS>("Bug") == VS_BUG, "FromString('Bug') is VS_BUG");
+static_assert(!cenum::from_string<enum VS>("VS_"), "FromString('VS_') is unknown");
+static_assert(cenum::index_of(VS_BUG) == 3, "IndexOf(VS_BUG) is the first element");
+static_assert(cenum::is_monotonic<enum VS>(), "VS is monotonic");
+static_assert(!cenum::is_contiguous<enum VS>(), "VS is not contiguous");
+
+/********************************/
+namespace shapes
+{
+
+#define SHAPE(_, _V, _S, _VS) \
+    _V(ANTI_LINE, -2) \
+    _V(POINT, 1) \
+    _(LINE) \
+    _(TRIANGLE) \
+
+ENUM(SHAPE);
+ENUM_IMPL_CONSTEXPR(SHAPE);
+
+} // namespace shapes
+
+static_assert(cenum::count<enum shapes::SHAPE> == 4, "SHAPE has 4 elements");
+static_assert(cenum::index_of(shapes::ANTI_LINE) == 0, "IndexOf(ANTI_LINE) is 0");
+static_assert(cenum::index_of(static_cast<enum shapes::SHAPE>(0)) == ENUM_INDEX_UNKNOWN, "0 is unknown");
+static_assert(!cenum::is_contiguous<enum shapes::SHAPE>(), "SHAPE is not contiguous");
+
+/********************************/
+#define DENSE(_, _V, _S, _VS) \
+    _V(DENSE_MINUS_1, -1) \
+    _(DENSE_0) \
+    _(DENSE_1) \
+
+ENUM(DENSE);
+ENUM_IMPL_CONSTEXPR(DENSE);
+
+static_assert(cenum::is_contiguous<enum DENSE>(), "DENSE is contiguous");
+static_assert(cenum::index_of(DENSE_1) == 2, "IndexOf(DENSE_1) is 2");
+static_assert(cenum::index_of(static_cast<enum DENSE>(2)) == ENUM_INDEX_UNKNOWN, "2 is unknown");
+static_assert(cenum::index_of(static_cast<enum DENSE>(-2)) == ENUM_INDEX_UNKNOWN, "-2 is unknown");
+
+/**
+ * Test range-for iteration visits every element in declaration order.
+ */
+static char* test_RangeFor(void)
+{
+    const char* expected[] = {"ANTI_LINE", "POINT", "LINE", "TRIANGLE"};
+    std::size_t count = 0;
+
+    for (enum shapes::SHAPE shape : cenum::values<enum shapes::SHAPE>)
+    {
+        mu_assert("test_RangeFor: element out of order",
+                  cenum::to_string(shape) == expected[count]);
+        count++;
+    }
+
+    mu_assert("test_RangeFor: incorrect iteration count", count == 4);
+
+    return 0;
+}
+
+/**
+ * Test lookups with runtime arguments.
+ */
+static char* test_RuntimeLookup(void)
+{
+    char name[] = "VS 4";
+    volatile int value = 4;
+
+    mu_assert("test_RuntimeLookup: ToString(4) not equal to 'VS 4'",
+              cenum::to_string(static_cast<enum VS>(value)) == name);
+    mu_assert("test_RuntimeLookup: FromString('VS 4') not equal to VS_4",
+              cenum::from_string<enum VS>(std::string_view(name, std::strlen(name))) == VS_4);
+
+    return 0;
+}
+
+/**
+ * Test the C tables and functions agree with the constexpr ones.
+ */
+static char* test_CInterop(void)
+{
+    for (const cenum::Entry<enum VS>& entry : cenum::entries<enum VS>)
+    {
+        enum VS found = VS_0;
+
+        mu_assert("test_CInterop: C and C++ ToString differ",
+                  cenum::to_string(entry.value) == VS_ToString(entry.value));
+        mu_assert("test_CInterop: C FromString failed",
+                  VS_FromString(entry.name.data(), entry.name.size(), &found) == ENUM_OK);
+        mu_assert("test_CInterop: C and C++ FromString differ",
+                  cenum::from_string<enum VS>(entry.name) == found);
+    }
+
+    return 0;
+}
+
+/********************************/
+char* test_enum_cpp(void)
+{
+    /*
+     * ENUM_IMPL_CONSTEXPR tests
+     */
+    mu_run_test(test_RangeFor);
+    mu_run_test(test_RuntimeLookup);
+    mu_run_test(test_CInterop);
+
+    return 0;
+}